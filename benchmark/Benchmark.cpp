@@ -3,8 +3,12 @@
 #include <Astra/System/SystemScheduler.hpp>
 #include <Astra/System/SystemExecutor.hpp>
 #include <benchmark/benchmark.h>
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
+#include <new>
 #include <queue>
+#include <random>
 #include <vector>
 #include <thread>
 
@@ -26,6 +30,52 @@ struct Comp
     int x;
 };
 
+// Heap allocations made by the current thread while an AllocationCounter is alive. Counting is
+// opt-in, so the other benchmarks only pay an untaken branch in operator new
+static std::atomic<bool> s_countAllocations{false};
+static thread_local size_t t_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+    if (s_countAllocations.load(std::memory_order_relaxed))
+    {
+        ++t_allocationCount;
+    }
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    std::abort();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+class AllocationCounter
+{
+public:
+    AllocationCounter() : m_start(t_allocationCount)
+    {
+        s_countAllocations.store(true, std::memory_order_relaxed);
+    }
+    
+    ~AllocationCounter()
+    {
+        s_countAllocations.store(false, std::memory_order_relaxed);
+    }
+    
+    size_t Count() const { return t_allocationCount - m_start; }
+    
+private:
+    size_t m_start;
+};
 
 static void BM_CreateEntities(benchmark::State& state)
 {
@@ -60,6 +110,127 @@ static void BM_CreateEntitiesBatch(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * count);
 }
 
+// Large scale entity benchmarks (100M needs a build with ASTRA_ENTITY_64)
+static bool SkipIfBeyondIDSpace(benchmark::State& state, size_t count)
+{
+    if (count > Astra::MAX_ENTITIES)
+    {
+        state.SkipWithError("Entity count exceeds the handle ID space, build with ASTRA_ENTITY_64");
+        return true;
+    }
+    return false;
+}
+
+static void BM_EntityManagerCreateLarge(benchmark::State& state)
+{
+    const size_t count = state.range(0);
+    if (SkipIfBeyondIDSpace(state, count)) return;
+    
+    std::vector<Astra::Entity> entities;
+    entities.reserve(count);
+    
+    for(auto _ : state)
+    {
+        Astra::EntityManager manager;
+        entities.clear();
+        manager.CreateBatch(count, std::back_inserter(entities));
+        benchmark::DoNotOptimize(entities.data());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_EntityManagerChurnLarge(benchmark::State& state)
+{
+    const size_t count = state.range(0);
+    if (SkipIfBeyondIDSpace(state, count)) return;
+    
+    Astra::EntityManager manager;
+    std::vector<Astra::Entity> entities;
+    entities.reserve(count);
+    manager.CreateBatch(count, std::back_inserter(entities));
+    
+    // Recycle 1% of the population per iteration at random slots
+    const size_t churn = count / 100;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, count - 1);
+    
+    for(auto _ : state)
+    {
+        for (size_t i = 0; i < churn; ++i)
+        {
+            Astra::Entity& entity = entities[dist(rng)];
+            manager.Destroy(entity);
+            entity = manager.Create();
+        }
+    }
+    
+    state.SetItemsProcessed(state.iterations() * churn);
+}
+
+static void BM_EntityManagerIsValidLarge(benchmark::State& state)
+{
+    const size_t count = state.range(0);
+    if (SkipIfBeyondIDSpace(state, count)) return;
+    
+    Astra::EntityManager manager;
+    std::vector<Astra::Entity> entities;
+    entities.reserve(count);
+    manager.CreateBatch(count, std::back_inserter(entities));
+    
+    // Random probes defeat the prefetcher, measuring the segment lookup itself
+    constexpr size_t probes = 1 << 20;
+    std::vector<Astra::Entity> sample(probes);
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, count - 1);
+    for (auto& entity : sample)
+    {
+        entity = entities[dist(rng)];
+    }
+    
+    for(auto _ : state)
+    {
+        size_t valid = 0;
+        for (const auto& entity : sample)
+        {
+            valid += manager.IsValid(entity);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * probes);
+}
+
+static void BM_EntityManagerIsValidBatchLarge(benchmark::State& state)
+{
+    const size_t count = state.range(0);
+    if (SkipIfBeyondIDSpace(state, count)) return;
+    
+    Astra::EntityManager manager;
+    std::vector<Astra::Entity> entities;
+    entities.reserve(count);
+    manager.CreateBatch(count, std::back_inserter(entities));
+    
+    // Same random probes as BM_EntityManagerIsValidLarge, validated in one batch
+    constexpr size_t probes = 1 << 20;
+    std::vector<Astra::Entity> sample(probes);
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, count - 1);
+    for (auto& entity : sample)
+    {
+        entity = entities[dist(rng)];
+    }
+    
+    std::vector<uint64_t> mask(Astra::EntityManager::BatchMaskWords(probes));
+    
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(manager.IsValidBatch(sample, mask));
+    }
+    
+    state.SetItemsProcessed(state.iterations() * probes);
+}
+
 // Component manipulation benchmarks
 static void BM_AddComponents(benchmark::State& state)
 {
@@ -579,15 +750,26 @@ static void BM_HierarchyTraversal(benchmark::State& state) {
         }
     }
     
-    // Benchmark descendant traversal
+    // Benchmark descendant traversal, reusing one scratch so warm traversals do not allocate.
+    // The filtered child visit groups through a leased scratch and is counted alongside it
+    auto relations = registry.GetRelations<Position>(root);
+    Astra::TraversalScratch scratch;
+    for (auto [entity, depth] : relations.GetDescendants(&scratch)) {
+        benchmark::DoNotOptimize(entity);
+    }
+    relations.ForEachChild([](Astra::Entity entity, Position&) { benchmark::DoNotOptimize(entity); });
+    
+    AllocationCounter allocations;
     for(auto _ : state) {
-        auto relations = registry.GetRelations<Position>(root);
         size_t count = 0;
-        for (auto [entity, depth] : relations.GetDescendants()) {
+        for (auto [entity, depth] : relations.GetDescendants(&scratch)) {
             benchmark::DoNotOptimize(count++);
         }
+        relations.ForEachChild([&](Astra::Entity, Position& pos) { benchmark::DoNotOptimize(pos); });
     }
     
+    state.counters["allocs_per_iter"] = benchmark::Counter(
+        static_cast<double>(allocations.Count()), benchmark::Counter::kAvgIterations);
     state.SetItemsProcessed(state.iterations() * allEntities.size());
 }
 
@@ -1047,6 +1229,12 @@ BENCHMARK(BM_CreateEntitiesBatch)->Arg(10000)->Arg(100000)->Arg(1000000);
 BENCHMARK(BM_AddComponents)->Arg(10000)->Arg(100000)->Arg(1000000);
 BENCHMARK(BM_RemoveComponents)->Arg(10000)->Arg(100000)->Arg(1000000);
 
+// Large scale entity handle benchmarks
+BENCHMARK(BM_EntityManagerCreateLarge)->Arg(1000000)->Arg(100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EntityManagerChurnLarge)->Arg(1000000)->Arg(100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EntityManagerIsValidLarge)->Arg(1000000)->Arg(100000000);
+BENCHMARK(BM_EntityManagerIsValidBatchLarge)->Arg(1000000)->Arg(100000000);
+
 // Batch component operations
 BENCHMARK(BM_AddComponentsBatch)->Arg(10000)->Arg(100000)->Arg(1000000);
 BENCHMARK(BM_RemoveComponentsBatch)->Arg(10000)->Arg(100000)->Arg(1000000);
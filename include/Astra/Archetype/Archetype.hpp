@@ -113,8 +113,10 @@ namespace Astra
     class Archetype
     {
     public:
-        explicit Archetype(ComponentMask mask) :
+        explicit Archetype(ComponentMask mask, Entity pairTarget = Entity::Invalid(), ComponentID pairRelation = INVALID_COMPONENT) :
             m_mask(mask),
+            m_pairTarget(pairTarget),
+            m_pairRelation(pairRelation),
             m_componentCount(mask.Count()),
             m_entityCount(0),
             m_entitiesPerChunk(0),
@@ -337,6 +339,7 @@ namespace Astra
             auto movedEntity = m_chunks[chunkIdx]->RemoveEntity(entityIdx);
 
             --m_entityCount;
+            ++m_layoutVersion;
 
             // Update first non-full chunk index if this chunk now has space
             if (chunkIdx < m_firstNonFullChunkIdx && !m_chunks[chunkIdx]->IsFull()) ASTRA_UNLIKELY
@@ -365,6 +368,7 @@ namespace Astra
 
             std::vector<std::pair<Entity, EntityLocation>> movedEntities;
             movedEntities.reserve(locations.size());
+            ++m_layoutVersion;
 
             std::vector<EntityLocation> sortedLocations(locations.begin(), locations.end());
             std::sort(sortedLocations.begin(), sortedLocations.end(), std::greater<EntityLocation>());
@@ -592,8 +596,16 @@ namespace Astra
         ASTRA_NODISCARD size_t GetChunkEntityCount(size_t chunkIndex) const noexcept { return (chunkIndex < m_chunks.size()) ? m_chunks[chunkIndex]->GetCount() : 0; }
         ASTRA_NODISCARD size_t GetEntitiesPerChunk() const noexcept { return m_entitiesPerChunk; }
         
+        // Changes whenever entities already stored here may have changed rows, appends don't count
+        ASTRA_NODISCARD uint32_t GetLayoutVersion() const noexcept { return m_layoutVersion; }
+        
         ASTRA_NODISCARD const ComponentMask& GetMask() const noexcept { return m_mask; }
         
+        // Pair archetypes hold entities sharing one (relation, target) pair, e.g. all children of a parent
+        ASTRA_NODISCARD Entity GetPairTarget() const noexcept { return m_pairTarget; }
+        ASTRA_NODISCARD ComponentID GetPairRelation() const noexcept { return m_pairRelation; }
+        ASTRA_NODISCARD bool IsPairArchetype() const noexcept { return m_pairTarget.IsValid(); }
+        
         template<Component C>
         ASTRA_NODISCARD bool HasComponent() const { return m_mask.Test(TypeID<C>::Value()); }
         ASTRA_NODISCARD bool HasComponent(ComponentID id) const { return m_mask.Test(id); }
@@ -919,6 +931,7 @@ namespace Astra
             }
 
             if (sparseChunks.empty()) ASTRA_LIKELY return {0, allMovedEntities};
+            ++m_layoutVersion;
 
             // Sort by utilization (least utilized first)
             std::sort(sparseChunks.begin(), sparseChunks.end(),
@@ -1295,6 +1308,8 @@ namespace Astra
         ASTRA_NODISCARD size_t GetEntitiesPerChunkMask() const noexcept { return m_entitiesPerChunkMask; }
 
         ComponentMask m_mask;
+        Entity m_pairTarget;                // Invalid unless this archetype stores a relationship pair
+        ComponentID m_pairRelation;         // Relation tag component of the pair
         size_t m_componentCount;  // Cached component count for fast access
         std::vector<ComponentDescriptor> m_componentDescriptors;
         std::vector<std::unique_ptr<ArchetypeChunk, ArchetypeChunkPool::ChunkDeleter>> m_chunks;
@@ -1303,6 +1318,7 @@ namespace Astra
         size_t m_entitiesPerChunkShift;     // For fast division via bit shift (log2(m_entitiesPerChunk))
         size_t m_entitiesPerChunkMask;      // For fast modulo operations (m_entitiesPerChunk - 1)
         size_t m_firstNonFullChunkIdx = 0;  // Track first chunk with available space for O(1) lookup
+        uint32_t m_layoutVersion = 0;       // Bumped by removals and chunk coalescing
         bool m_initialized;
         
         static constexpr float COALESCE_UTILIZATION_THRESHOLD = 0.5f;
@@ -8,6 +8,7 @@
 #include <limits>
 #include <memory>
 #include <ranges>
+#include <shared_mutex>
 #include <span>
 #include <tuple>
 #include <unordered_map>
@@ -134,7 +135,7 @@ namespace Astra
          */
         ASTRA_NODISCARD Archetype* FindArchetype(const ComponentMask& mask) const
         {
-            auto it = m_archetypeMap.Find(mask);
+            auto it = m_archetypeMap.Find(ArchetypeKey{mask, Entity::Invalid()});
             if (it != m_archetypeMap.end())
             {
                 return it->second;
@@ -142,6 +143,99 @@ namespace Astra
             return nullptr;
         }
         
+        /**
+         * Pair an entity with a target, moving it into the archetype for its components plus the
+         * relation tag and that target. Entities sharing a pair share archetypes and chunks.
+         * @tparam Relation Tag component marking the pair in the mask, e.g. ChildOf
+         * @param entity Entity to pair
+         * @param target Pair target, Entity::Invalid() drops the pair and the tag
+         * @return False if the entity is unknown or the move failed
+         */
+        template<Component Relation>
+        bool SetPairTarget(Entity entity, Entity target)
+        {
+            m_componentRegistry->RegisterComponent<Relation>();
+            return SetPairTarget(entity, TypeID<Relation>::Value(), target);
+        }
+        
+        /**
+         * Get the pair target of an entity
+         * @return Entity::Invalid() if the entity is unknown or holds no pair
+         */
+        ASTRA_NODISCARD Entity GetPairTarget(Entity entity) const
+        {
+            auto it = m_entityMap.find(entity);
+            return it != m_entityMap.end() ? it->second.archetype->GetPairTarget() : Entity::Invalid();
+        }
+        
+        /**
+         * Get every archetype whose pair targets the given entity
+         * @return Archetypes in creation order, empty if nothing is paired with target
+         */
+        ASTRA_NODISCARD std::span<Archetype* const> GetPairArchetypes(Entity target) const
+        {
+            auto it = m_pairArchetypes.Find(target);
+            if (it == m_pairArchetypes.end())
+            {
+                return {};
+            }
+            return {it->second.data(), it->second.size()};
+        }
+        
+        /**
+         * Drop the pair from every entity paired with target, used when target is destroyed
+         * The emptied archetypes leave the target's index and are kept for the next target with
+         * the same components, so parent churn does not grow the archetype count. They are not
+         * freed, iterations in flight may still hold them.
+         * @return Number of entities moved out of pair archetypes
+         */
+        size_t ClearPairTarget(Entity target)
+        {
+            auto it = m_pairArchetypes.Find(target);
+            if (it == m_pairArchetypes.end())
+            {
+                return 0;
+            }
+            
+            // Moving entities creates archetypes, which may rehash the index
+            SmallVector<Archetype*, 4> archetypes = it->second;
+            
+            size_t moved = 0;
+            for (Archetype* archetype : archetypes)
+            {
+                if (archetype->GetEntityCount() == 0)
+                {
+                    continue;
+                }
+                
+                SmallVector<std::pair<Entity, EntityLocation>, 8> batch;
+                batch.reserve(archetype->GetEntityCount());
+                for (const auto& chunk : archetype->GetChunks())
+                {
+                    const auto& entities = chunk->GetEntities();
+                    for (size_t i = 0; i < chunk->GetCount(); ++i)
+                    {
+                        batch.push_back({entities[i], m_entityMap[entities[i]].location});
+                    }
+                }
+                
+                ComponentMask mask = archetype->GetMask();
+                mask.Reset(archetype->GetPairRelation());
+                BatchMoveEntitiesWithoutComponent(archetype, GetOrCreateArchetype(mask), batch);
+                moved += batch.size();
+            }
+            
+            for (Archetype* archetype : archetypes)
+            {
+                if (archetype->GetEntityCount() == 0)
+                {
+                    RetirePairArchetype(archetype);
+                }
+            }
+            
+            return moved;
+        }
+        
         /**
          * Add entity to storage (in root archetype)
          * Entity should be created by EntityManager
@@ -317,6 +411,38 @@ namespace Astra
             return loc.archetype->GetComponent<T>(loc.location);
         }
         
+        /**
+         * Gather components for a list of entities
+         * Entities that are missing or lack a component get nullptr in that output span
+         */
+        template<Component... Ts>
+        void GetComponents(std::span<const Entity> entities, std::span<Ts*>... outComponents)
+        {
+            static_assert(sizeof...(Ts) > 0, "GetComponents needs at least one component");
+            ASTRA_ASSERT(((outComponents.size() >= entities.size()) && ...), "Output span smaller than entity list");
+            
+            ForEachResolved<Ts...>(entities, [&](size_t i, Ts*... components)
+            {
+                ((outComponents[i] = components), ...);
+            });
+        }
+        
+        /**
+         * Call func(entity, Ts&...) for each listed entity that has all of Ts, in list order
+         * The callback must not add or remove components or destroy entities
+         */
+        template<Component... Ts, typename Func>
+        void ForEachEntity(std::span<const Entity> entities, Func&& func)
+        {
+            ForEachResolved<Ts...>(entities, [&](size_t i, Ts*... components)
+            {
+                if ((components && ...))
+                {
+                    func(entities[i], *components...);
+                }
+            });
+        }
+        
         /**
          * Check if entity has a component
          */
@@ -341,13 +467,119 @@ namespace Astra
         }
         
         /**
-         * Query archetypes that match a component mask
+         * Get the current structural change counter for fast path checking
+         * This is incremented whenever archetypes are created or removed
          */
-        ASTRA_NODISCARD auto QueryArchetypes(const ComponentMask& mask)
+        ASTRA_NODISCARD uint32_t GetStructuralChangeCounter() const noexcept
         {
-            return m_archetypes |
-                std::views::transform([](auto& entry) { return entry.archetype.get(); }) |
-                std::views::filter([mask](Archetype* arch) { return arch->GetMask().HasAll(mask); });
+            return m_structuralChangeCounter.load(std::memory_order_acquire);
+        }
+        
+        /**
+         * Query archetypes that contain every component of a mask
+         * Starts from the per-component archetype index of the rarest component in the mask, so
+         * the cost follows that component's archetype count rather than the total.
+         */
+        ASTRA_NODISCARD std::vector<Archetype*> QueryArchetypes(const ComponentMask& mask) const
+        {
+            std::vector<Archetype*> result;
+            ForEachArchetypeWithAll(mask, [&](Archetype* archetype) { result.push_back(archetype); });
+            return result;
+        }
+        
+        /**
+         * Signature of a cached query, see GetQueryArchetypes
+         */
+        using QueryMatcher = bool(*)(const ComponentMask&);
+        
+        /**
+         * A registered query and the archetypes matching it, shared by all views with the same query
+         * Structural changes update the list under the query lock and bump version, readers that
+         * may run alongside them copy it with CopyQueryArchetypes.
+         */
+        struct CachedQuery
+        {
+            QueryMatcher matcher;
+            std::vector<Archetype*> archetypes;
+            std::atomic<uint64_t> version{1};
+        };
+        
+        /**
+         * Get a cached query, registering it on first use
+         * Registered lists are updated as archetypes are created and removed, so repeated
+         * lookups never rescan the archetypes. Lists are in creation order and include empty
+         * archetypes. Each distinct matcher is one query; views pass QueryBuilder::Matches.
+         * required must be implied by the matcher, it narrows the initial scan to archetypes
+         * holding its rarest component.
+         */
+        ASTRA_NODISCARD CachedQuery& GetQuery(QueryMatcher matcher, const ComponentMask& required = {})
+        {
+            const auto key = reinterpret_cast<std::uintptr_t>(matcher);
+            {
+                std::shared_lock lock(m_queryMutex);
+                auto it = m_queryIndex.Find(key);
+                if (it != m_queryIndex.end()) ASTRA_LIKELY
+                {
+                    return *it->second;
+                }
+            }
+            
+            std::unique_lock lock(m_queryMutex);
+            auto it = m_queryIndex.Find(key);
+            if (it != m_queryIndex.end())
+            {
+                return *it->second;
+            }
+            
+            auto query = std::make_unique<CachedQuery>();
+            query->matcher = matcher;
+            ForEachArchetypeWithAll(required, [&](Archetype* archetype)
+            {
+                if (matcher(archetype->GetMask()))
+                {
+                    query->archetypes.push_back(archetype);
+                }
+            });
+            
+            CachedQuery* ptr = query.get();
+            m_queries.push_back(std::move(query));
+            m_queryIndex[key] = ptr;
+            return *ptr;
+        }
+        
+        /**
+         * Get the archetypes matching a cached query, see GetQuery
+         * The list is shared and changes in place with structural changes, so it must not be
+         * read while one may run on another thread; use CopyQueryArchetypes there.
+         */
+        ASTRA_NODISCARD const std::vector<Archetype*>& GetQueryArchetypes(QueryMatcher matcher, const ComponentMask& required = {})
+        {
+            return GetQuery(matcher, required).archetypes;
+        }
+        
+        /**
+         * Copy the archetypes of a cached query into out unless they are unchanged since version
+         * Safe alongside structural changes. version is updated to the copied state, 0 always copies.
+         * @return true if out was refreshed
+         */
+        bool CopyQueryArchetypes(const CachedQuery& query, std::vector<Archetype*>& out, uint64_t& version) const
+        {
+            if (query.version.load(std::memory_order_acquire) == version) ASTRA_LIKELY
+                return false;
+            
+            std::shared_lock lock(m_queryMutex);
+            out.assign(query.archetypes.begin(), query.archetypes.end());
+            version = query.version.load(std::memory_order_relaxed);
+            return true;
+        }
+        
+        /**
+         * Get the number of registered cached queries
+         */
+        ASTRA_NODISCARD size_t GetCachedQueryCount() const
+        {
+            std::shared_lock lock(m_queryMutex);
+            return m_queries.size();
         }
         
         /**
@@ -546,6 +778,12 @@ namespace Astra
             return m_archetypes.size();
         }
         
+        // Get the current generation number, bumped whenever an archetype is created
+        ASTRA_NODISCARD uint32_t GetCurrentGeneration() const noexcept
+        {
+            return m_generation;
+        }
+        
         // Get approximate memory usage
         ASTRA_NODISCARD size_t GetArchetypeMemoryUsage() const
         {
@@ -645,8 +883,10 @@ namespace Astra
                 // Write archetype index for reference
                 writer(static_cast<uint32_t>(i));
                 
-                // Serialize the archetype
+                // Serialize the archetype, retired pairs without their dead target so loading parks them again
                 entry.archetype->Serialize(writer);
+                writer(IsRetiredPairArchetype(entry.archetype.get()) ? Entity::Invalid() : entry.archetype->GetPairTarget());
+                writer(entry.archetype->GetPairRelation());
                 
                 // Write metrics
                 writer(entry.metrics.currentEntityCount);
@@ -688,7 +928,28 @@ namespace Astra
                 m_archetypes.pop_back();
             }
             m_archetypeMap.Clear();
+            m_pairArchetypes.Clear();
+            m_retiredPairArchetypes.Clear();
+            for (auto& list : m_componentArchetypes)
+            {
+                list.clear();
+            }
             m_entityMap.clear();
+            m_structuralChangeCounter.fetch_add(1, std::memory_order_release);  // Archetypes were destroyed
+            
+            // Only the root survives, loaded archetypes are pushed again as they are registered
+            {
+                std::unique_lock lock(m_queryMutex);
+                for (const auto& query : m_queries)
+                {
+                    query->archetypes.clear();
+                    if (query->matcher(m_rootArchetype->GetMask()))
+                    {
+                        query->archetypes.push_back(m_rootArchetype);
+                    }
+                    query->version.fetch_add(1, std::memory_order_release);
+                }
+            }
             
             // Read storage metadata
             uint32_t archetypeCount, entityCount;
@@ -720,6 +981,12 @@ namespace Astra
                     return false;
                 }
                 
+                // v2 archives carry the pair of each archetype
+                if (reader.GetVersion() >= 2)
+                {
+                    reader(archetype->m_pairTarget)(archetype->m_pairRelation);
+                }
+                
                 // Read metrics
                 ArchetypeMetrics metrics;
                 reader(metrics.currentEntityCount);
@@ -731,7 +998,17 @@ namespace Astra
                 entry.archetype = std::move(archetype);
                 entry.metrics = metrics;
                 
-                m_archetypeMap[entry.archetype->GetMask()] = entry.archetype.get();
+                // A relation without a target marks a retired pair archetype
+                Archetype* ptr = entry.archetype.get();
+                if (ptr->GetPairRelation() != INVALID_COMPONENT && !ptr->GetPairTarget().IsValid())
+                {
+                    m_retiredPairArchetypes[ArchetypeKey{ptr->GetMask(), Entity::Invalid()}].push_back(ptr);
+                    IndexArchetype(ptr);
+                }
+                else
+                {
+                    RegisterArchetype(ptr);
+                }
                 m_archetypes.push_back(std::move(entry));
             }
             
@@ -762,17 +1039,29 @@ namespace Astra
         
         
     private:        
-        ASTRA_NODISCARD Archetype* GetOrCreateArchetype(const ComponentMask& mask)
+        ASTRA_NODISCARD Archetype* GetOrCreateArchetype(const ComponentMask& mask, Entity pairTarget = Entity::Invalid(), ComponentID pairRelation = INVALID_COMPONENT)
         {
             // Check if archetype already exists
-            auto it = m_archetypeMap.Find(mask);
+            auto it = m_archetypeMap.Find(ArchetypeKey{mask, pairTarget});
             if (it != m_archetypeMap.end()) ASTRA_LIKELY
             {
                 return it->second;
             }
+            
+            // A pair archetype retired with its old target only needs the new one
+            if (pairTarget.IsValid())
+            {
+                if (Archetype* retired = TakeRetiredPairArchetype(mask, pairRelation))
+                {
+                    retired->m_pairTarget = pairTarget;
+                    m_archetypeMap[ArchetypeKey{mask, pairTarget}] = retired;
+                    m_pairArchetypes[pairTarget].push_back(retired);
+                    return retired;
+                }
+            }
 
             // Create new archetype
-            auto archetype = std::make_unique<Archetype>(mask);
+            auto archetype = std::make_unique<Archetype>(mask, pairTarget, pairRelation);
             Archetype* ptr = archetype.get();
             
             // Set the pool for the new archetype
@@ -798,7 +1087,7 @@ namespace Astra
             ptr->Initialize(componentDescriptors);
 
             // Store archetype
-            m_archetypeMap[mask] = ptr;
+            RegisterArchetype(ptr);
             
             ArchetypeEntry entry;
             entry.archetype = std::move(archetype);
@@ -824,8 +1113,8 @@ namespace Astra
             ComponentMask newMask = from->GetMask();
             newMask.Set(componentId);
             
-            // Get or create archetype
-            Archetype* to = GetOrCreateArchetype(newMask);
+            // Get or create archetype, keeping the pair of the source
+            Archetype* to = GetOrCreateArchetype(newMask, from->GetPairTarget(), from->GetPairRelation());
             
             // Cache edge in the edge graph
             m_edgeGraph.SetAddEdge(from, componentId, to);
@@ -845,8 +1134,10 @@ namespace Astra
             ComponentMask newMask = from->GetMask();
             newMask.Reset(componentId);
             
-            // Get or create archetype
-            Archetype* to = GetOrCreateArchetype(newMask);
+            // Get or create archetype, removing the relation tag drops the pair with it
+            Archetype* to = componentId == from->GetPairRelation()
+                ? GetOrCreateArchetype(newMask)
+                : GetOrCreateArchetype(newMask, from->GetPairTarget(), from->GetPairRelation());
             
             // Cache edge in the edge graph
             m_edgeGraph.SetRemoveEdge(from, componentId, to);
@@ -854,23 +1145,6 @@ namespace Astra
             return to;
         }
         
-        /**
-         * Get the current structural change counter for fast path checking
-         * This is incremented whenever archetypes are created or removed
-         */
-        ASTRA_NODISCARD uint32_t GetStructuralChangeCounter() const noexcept
-        {
-            return m_structuralChangeCounter.load(std::memory_order_acquire);
-        }
-        
-        /**
-         * Get the current generation number
-         */
-        ASTRA_NODISCARD uint32_t GetCurrentGeneration() const noexcept
-        {
-            return m_generation;
-        }
-        
         /**
          * Get archetypes created after a specific generation
          * Used for incremental view updates
@@ -889,6 +1163,36 @@ namespace Astra
         }
         
     private:
+        bool SetPairTarget(Entity entity, ComponentID relation, Entity target)
+        {
+            auto it = m_entityMap.find(entity);
+            if (it == m_entityMap.end()) ASTRA_UNLIKELY return false;
+            
+            EntityRecord& record = it->second;
+            Archetype* from = record.archetype;
+            if (from->GetPairTarget() == target)
+            {
+                return true;
+            }
+            
+            ASTRA_ASSERT(!from->IsPairArchetype() || from->GetPairRelation() == relation, "Entity already holds a pair of another relation");
+            
+            ComponentMask mask = from->GetMask();
+            Archetype* to;
+            if (target.IsValid())
+            {
+                mask.Set(relation);
+                to = GetOrCreateArchetype(mask, target, relation);
+            }
+            else
+            {
+                mask.Reset(relation);
+                to = GetOrCreateArchetype(mask);
+            }
+            
+            return MoveEntity(entity, record, to).IsValid();
+        }
+        
         /**
          * Move entity to a new archetype (used after component removal)
          * Does NOT construct any new components, just transfers existing ones
@@ -1247,6 +1551,8 @@ namespace Astra
         }
         
     private:
+        static constexpr size_t GATHER_WINDOW = 8;  // Entities resolved ahead in batched lookups
+        
         // Archetype entry with metrics
         struct ArchetypeEntry
         {
@@ -1259,7 +1565,32 @@ namespace Astra
         std::shared_ptr<ComponentRegistry> m_componentRegistry;  // Shared component registry
         ArchetypeGraph m_edgeGraph;  // Manages archetype transition graph
         std::vector<ArchetypeEntry> m_archetypes;
-        FlatMap<ComponentMask, Archetype*, BitmapHash<MAX_COMPONENTS>> m_archetypeMap;
+        // Archetypes are keyed by mask and pair target, so one relation tag bit can split entities
+        // into an archetype per target without spending a component ID per target
+        struct ArchetypeKey
+        {
+            ComponentMask mask;
+            Entity pairTarget;
+            
+            bool operator==(const ArchetypeKey&) const = default;
+        };
+        
+        struct ArchetypeKeyHash
+        {
+            size_t operator()(const ArchetypeKey& key) const noexcept
+            {
+                return key.mask.GetHash() ^ (std::hash<Entity>{}(key.pairTarget) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+        
+        FlatMap<ArchetypeKey, Archetype*, ArchetypeKeyHash> m_archetypeMap;
+        
+        std::vector<std::unique_ptr<CachedQuery>> m_queries;  // Owned, lists keep their address
+        FlatMap<std::uintptr_t, CachedQuery*> m_queryIndex;   // Matcher address -> query
+        mutable std::shared_mutex m_queryMutex;                // Guards the index and every query's list
+        FlatMap<Entity, SmallVector<Archetype*, 4>> m_pairArchetypes;  // Pair target -> archetypes pairing with it
+        FlatMap<ArchetypeKey, SmallVector<Archetype*, 4>, ArchetypeKeyHash> m_retiredPairArchetypes;  // Mask -> emptied pair archetypes awaiting a new target
+        std::array<std::vector<Archetype*>, MAX_COMPONENTS> m_componentArchetypes;  // Component -> archetypes holding it, creation order
         std::unordered_map<Entity, EntityRecord> m_entityMap;
         
         Archetype* m_rootArchetype = nullptr;
@@ -1268,6 +1599,72 @@ namespace Astra
         std::atomic<uint32_t> m_structuralChangeCounter{0};  // Fast path check
         uint32_t m_generation = 1;  // Generation counter for new archetypes
         
+        void RegisterArchetype(Archetype* archetype)
+        {
+            m_archetypeMap[ArchetypeKey{archetype->GetMask(), archetype->GetPairTarget()}] = archetype;
+            if (archetype->IsPairArchetype())
+            {
+                m_pairArchetypes[archetype->GetPairTarget()].push_back(archetype);
+            }
+            IndexArchetype(archetype);
+        }
+        
+        // Add an archetype to the component lists and every cached query it matches
+        void IndexArchetype(Archetype* archetype)
+        {
+            const ComponentMask& mask = archetype->GetMask();
+            for (ComponentID id = 0; id < MAX_COMPONENTS; ++id)
+            {
+                if (mask.Test(id))
+                {
+                    m_componentArchetypes[id].push_back(archetype);
+                }
+            }
+            
+            // Push the new archetype to every cached query it matches
+            std::unique_lock lock(m_queryMutex);
+            for (const auto& query : m_queries)
+            {
+                if (query->matcher(archetype->GetMask()))
+                {
+                    query->archetypes.push_back(archetype);
+                    query->version.fetch_add(1, std::memory_order_release);
+                }
+            }
+        }
+        
+        // Visits the archetypes containing all of required. Only the index list of the rarest
+        // required component is scanned; with nothing required every archetype is visited.
+        template<typename Func>
+        void ForEachArchetypeWithAll(const ComponentMask& required, Func&& func) const
+        {
+            const std::vector<Archetype*>* rarest = nullptr;
+            for (ComponentID id = 0; id < MAX_COMPONENTS; ++id)
+            {
+                if (required.Test(id) && (!rarest || m_componentArchetypes[id].size() < rarest->size()))
+                {
+                    rarest = &m_componentArchetypes[id];
+                }
+            }
+            
+            if (!rarest)
+            {
+                for (const auto& entry : m_archetypes)
+                {
+                    func(entry.archetype.get());
+                }
+                return;
+            }
+            
+            for (Archetype* archetype : *rarest)
+            {
+                if (archetype->GetMask().HasAll(required))
+                {
+                    func(archetype);
+                }
+            }
+        }
+        
         // Helper to update metrics when entity count changes
         void UpdateArchetypeMetrics(Archetype* archetype)
         {
@@ -1288,14 +1685,189 @@ namespace Astra
             
             Archetype* archetype = m_archetypes[index].archetype.get();
             
-            // Remove from archetype map
-            m_archetypeMap.Erase(archetype->GetMask());
+            // Remove from archetype map, retired pair archetypes already left it
+            if (!ForgetRetiredPairArchetype(archetype))
+            {
+                UnregisterArchetypeKey(archetype);
+            }
             
             // Remove all edges involving this archetype
             RemoveArchetypeEdges(archetype);
             
+            const ComponentMask& mask = archetype->GetMask();
+            for (ComponentID id = 0; id < MAX_COMPONENTS; ++id)
+            {
+                if (mask.Test(id))
+                {
+                    auto& list = m_componentArchetypes[id];
+                    list.erase(std::find(list.begin(), list.end(), archetype));
+                }
+            }
+            
+            {
+                std::unique_lock lock(m_queryMutex);
+                for (const auto& query : m_queries)
+                {
+                    auto& list = query->archetypes;
+                    auto it = std::find(list.begin(), list.end(), archetype);
+                    if (it != list.end())
+                    {
+                        list.erase(it);
+                        query->version.fetch_add(1, std::memory_order_release);
+                    }
+                }
+            }
+            
             // Remove the archetype entry (this will destroy the archetype)
             m_archetypes.erase(m_archetypes.begin() + index);
+            
+            // Cached archetype pointers must not outlive the archetype
+            m_structuralChangeCounter.fetch_add(1, std::memory_order_release);
+        }
+        
+        /**
+         * Visit func(i, Ts*...) for each entity in list order, missing components are nullptr
+         * 
+         * Two stages run ahead of the entity being visited: the map probe of entity i + 2 * GATHER_WINDOW
+         * prefetches its chunk header, then entity i + GATHER_WINDOW resolves its component pointers
+         * against that header and prefetches the rows. The pointers are kept in the window, so each
+         * component is located once. m_entityMap is a node-based std::unordered_map whose buckets
+         * cannot be addressed without probing, so the probe is hoisted a window further instead.
+         */
+        template<Component... Ts, typename Func>
+        void ForEachResolved(std::span<const Entity> entities, Func&& func)
+        {
+            std::array<const EntityRecord*, GATHER_WINDOW> records;
+            std::array<std::tuple<Ts*...>, GATHER_WINDOW> resolved;
+            
+            auto probe = [&](size_t i) -> const EntityRecord*
+            {
+                auto it = m_entityMap.find(entities[i]);
+                if (it == m_entityMap.end()) ASTRA_UNLIKELY
+                    return nullptr;
+                
+                const EntityRecord* record = &it->second;
+                Simd::Ops::PrefetchT0(record->archetype->GetChunks()[record->location.GetChunkIndex()].get());
+                return record;
+            };
+            auto resolve = [](const EntityRecord* record) -> std::tuple<Ts*...>
+            {
+                if (!record) ASTRA_UNLIKELY
+                    return {};
+                
+                std::tuple<Ts*...> components{record->archetype->template GetComponent<Ts>(record->location)...};
+                (Simd::Ops::PrefetchT0(std::get<Ts*>(components)), ...);
+                return components;
+            };
+            
+            const size_t count = entities.size();
+            for (size_t i = 0; i < std::min(count, GATHER_WINDOW); ++i)
+            {
+                resolved[i] = resolve(probe(i));
+            }
+            for (size_t i = GATHER_WINDOW; i < std::min(count, 2 * GATHER_WINDOW); ++i)
+            {
+                records[i % GATHER_WINDOW] = probe(i);
+            }
+            
+            for (size_t i = 0; i < count; ++i)
+            {
+                // The slot holds the pointers of entity i and the record of entity i + GATHER_WINDOW
+                const size_t slot = i % GATHER_WINDOW;
+                const std::tuple<Ts*...> components = resolved[slot];
+                if (i + GATHER_WINDOW < count)
+                {
+                    resolved[slot] = resolve(records[slot]);
+                }
+                if (i + 2 * GATHER_WINDOW < count)
+                {
+                    records[slot] = probe(i + 2 * GATHER_WINDOW);
+                }
+                std::apply([&](Ts*... pointers) { func(i, pointers...); }, components);
+            }
+        }
+        
+        // Drop an archetype from the key map and its pair target's list
+        void UnregisterArchetypeKey(Archetype* archetype)
+        {
+            m_archetypeMap.Erase(ArchetypeKey{archetype->GetMask(), archetype->GetPairTarget()});
+            if (archetype->IsPairArchetype())
+            {
+                auto pairIt = m_pairArchetypes.Find(archetype->GetPairTarget());
+                auto& list = pairIt->second;
+                list.erase(std::find(list.begin(), list.end(), archetype));
+                if (list.empty())
+                {
+                    m_pairArchetypes.Erase(archetype->GetPairTarget());
+                }
+            }
+        }
+        
+        // Park an empty pair archetype whose target is gone, its cached edges lead to archetypes of that target
+        void RetirePairArchetype(Archetype* archetype)
+        {
+            UnregisterArchetypeKey(archetype);
+            RemoveArchetypeEdges(archetype);
+            m_retiredPairArchetypes[ArchetypeKey{archetype->GetMask(), Entity::Invalid()}].push_back(archetype);
+        }
+        
+        // Reuse a retired pair archetype with the same components and relation, null if none is parked
+        Archetype* TakeRetiredPairArchetype(const ComponentMask& mask, ComponentID relation)
+        {
+            auto it = m_retiredPairArchetypes.Find(ArchetypeKey{mask, Entity::Invalid()});
+            if (it == m_retiredPairArchetypes.end())
+            {
+                return nullptr;
+            }
+            
+            auto& list = it->second;
+            auto match = std::find_if(list.begin(), list.end(), [relation](const Archetype* archetype)
+            {
+                return archetype->GetPairRelation() == relation;
+            });
+            if (match == list.end())
+            {
+                return nullptr;
+            }
+            
+            Archetype* archetype = *match;
+            list.erase(match);
+            if (list.empty())
+            {
+                m_retiredPairArchetypes.Erase(it);
+            }
+            return archetype;
+        }
+        
+        ASTRA_NODISCARD bool IsRetiredPairArchetype(const Archetype* archetype) const
+        {
+            auto it = m_retiredPairArchetypes.Find(ArchetypeKey{archetype->GetMask(), Entity::Invalid()});
+            return it != m_retiredPairArchetypes.end() &&
+                std::find(it->second.begin(), it->second.end(), archetype) != it->second.end();
+        }
+        
+        // Drop an archetype from the retired pairs, false if it was not retired
+        bool ForgetRetiredPairArchetype(Archetype* archetype)
+        {
+            auto it = m_retiredPairArchetypes.Find(ArchetypeKey{archetype->GetMask(), Entity::Invalid()});
+            if (it == m_retiredPairArchetypes.end())
+            {
+                return false;
+            }
+            
+            auto& list = it->second;
+            auto match = std::find(list.begin(), list.end(), archetype);
+            if (match == list.end())
+            {
+                return false;
+            }
+            
+            list.erase(match);
+            if (list.empty())
+            {
+                m_retiredPairArchetypes.Erase(it);
+            }
+            return true;
         }
         
         // Remove all edges to/from an archetype
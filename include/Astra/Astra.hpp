@@ -18,6 +18,7 @@
 
 // Memory management
 #include "Core/Memory.hpp"
+#include "Core/JobSystem.hpp"
 
 // Container types
 #include "Container/AlignedStorage.hpp"
@@ -45,10 +46,15 @@
 #include "Archetype/ArchetypeManager.hpp"
 
 // Registry and queries
+#include "Registry/EntityRef.hpp"
 #include "Registry/Query.hpp"
 #include "Registry/View.hpp"
+#include "Registry/ChunkView.hpp"
+#include "Registry/LinkSnapshot.hpp"
 #include "Registry/RelationshipGraph.hpp"
+#include "Registry/ResourceStorage.hpp"
 #include "Registry/Relations.hpp"
+#include "Registry/HierarchyView.hpp"
 #include "Registry/Registry.hpp"
 
 // Command buffer system
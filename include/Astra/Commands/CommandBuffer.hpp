@@ -17,6 +17,10 @@ namespace Astra
      * Main interface for deferred command execution in Astra
      * Provides a high-performance, cache-friendly way to batch operations
      * 
+     * The registry must outlive the buffer: entity handles are reserved from it while
+     * recording, and Clear (which Execute runs by default) hands the unused ones back, so
+     * no reservation outlives a frame where Save or Registry::Clear could miss it.
+     * 
      * Example usage:
      * @code
      * CommandBuffer buffer(&registry);
@@ -65,13 +69,15 @@ namespace Astra
         // This is a simplified approach - in production you might want a more sophisticated system
         std::vector<std::function<void(Registry*)>> m_componentCommands;
         
-        // Entity ID generator for temporary entities
-        mutable Entity::IDType m_nextTempId = std::numeric_limits<Entity::IDType>::max();
+        // Handles reserved from the registry in blocks, so recording a creation is usually a plain array read
+        static constexpr size_t RESERVE_BLOCK = 64;
+        std::vector<Entity> m_reserveBlock;
+        size_t m_reserveNext = 0;
         
     public:
         /**
          * Create a command buffer for a specific registry
-         * @param registry The registry to execute commands on
+         * @param registry The registry to execute commands on, must outlive the buffer
          */
         explicit CommandBuffer(Registry* registry)
             : m_registry(registry)
@@ -80,22 +86,44 @@ namespace Astra
             ASTRA_ASSERT(registry != nullptr, "Registry cannot be null");
         }
         
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+        
+        ~CommandBuffer()
+        {
+            // Give back every handle that never made it to playback
+            Clear();
+        }
+        
         // ============= Entity Commands =============
         
         /**
          * Record a command to create an entity
-         * @return A temporary entity ID that will be mapped to the real entity on execution
+         * @return The real handle the entity will have once executed, usable in other commands
+         *         and storable right away. Entity::Invalid() if the ID space is exhausted
          */
         Entity CreateEntity()
         {
-            Entity tempEntity{m_nextTempId--};
-            m_baseStorage.Add(Commands::CreateEntity{tempEntity});
-            return tempEntity;
+            if (m_reserveNext == m_reserveBlock.size()) ASTRA_UNLIKELY
+            {
+                m_reserveBlock.resize(RESERVE_BLOCK);
+                m_reserveBlock.resize(m_registry->ReserveEntities(m_reserveBlock));
+                m_reserveNext = 0;
+                
+                if (m_reserveBlock.empty())
+                {
+                    return Entity::Invalid();
+                }
+            }
+            
+            Entity entity = m_reserveBlock[m_reserveNext++];
+            m_baseStorage.Add(Commands::CreateEntity{entity});
+            return entity;
         }
         
         /**
          * Record a command to destroy an entity
-         * @param entity The entity to destroy (can be temporary or real)
+         * @param entity The entity to destroy (can be recorded in this buffer or already live)
          */
         void DestroyEntity(Entity entity)
         {
@@ -128,21 +156,16 @@ namespace Astra
         /**
          * Record a command to add a component to an entity
          * @tparam T The component type
-         * @param entity The entity (can be temporary or real)
+         * @param entity The entity (can be recorded in this buffer or already live)
          * @param component The component value
          */
         template<Component T>
         void AddComponent(Entity entity, T&& component)
         {
             m_componentCommands.emplace_back(
-                [entity, comp = std::forward<T>(component), this](Registry* registry) mutable
+                [entity, comp = std::forward<T>(component)](Registry* registry) mutable
                 {
-                    // Resolve entity through executor's remapping
-                    Entity resolvedEntity = m_baseExecutor.ResolveEntity(entity);
-                    if (resolvedEntity != Entity::Invalid())
-                    {
-                        registry->AddComponent<T>(resolvedEntity, std::move(comp));
-                    }
+                    registry->AddComponent<T>(entity, std::move(comp));
                 }
             );
         }
@@ -150,19 +173,15 @@ namespace Astra
         /**
          * Record a command to remove a component from an entity
          * @tparam T The component type
-         * @param entity The entity (can be temporary or real)
+         * @param entity The entity (can be recorded in this buffer or already live)
          */
         template<Component T>
         void RemoveComponent(Entity entity)
         {
             m_componentCommands.emplace_back(
-                [entity, this](Registry* registry)
+                [entity](Registry* registry)
                 {
-                    Entity resolvedEntity = m_baseExecutor.ResolveEntity(entity);
-                    if (resolvedEntity != Entity::Invalid())
-                    {
-                        registry->RemoveComponent<T>(resolvedEntity);
-                    }
+                    registry->RemoveComponent<T>(entity);
                 }
             );
         }
@@ -170,26 +189,27 @@ namespace Astra
         /**
          * Record a command to set/update a component value
          * @tparam T The component type
-         * @param entity The entity (can be temporary or real)
+         * @param entity The entity (can be recorded in this buffer or already live)
          * @param component The new component value
          */
         template<Component T>
         void SetComponent(Entity entity, T&& component)
         {
             m_componentCommands.emplace_back(
-                [entity, comp = std::forward<T>(component), this](Registry* registry) mutable
+                [entity, comp = std::forward<T>(component)](Registry* registry) mutable
                 {
-                    Entity resolvedEntity = m_baseExecutor.ResolveEntity(entity);
-                    if (resolvedEntity != Entity::Invalid())
+                    if (!registry->IsValid(entity))
                     {
-                        if (T* existing = registry->GetComponent<T>(resolvedEntity))
-                        {
-                            *existing = std::move(comp);
-                        }
-                        else
-                        {
-                            registry->AddComponent<T>(resolvedEntity, std::move(comp));
-                        }
+                        return;
+                    }
+                    
+                    if (T* existing = registry->GetComponent<T>(entity))
+                    {
+                        *existing = std::move(comp);
+                    }
+                    else
+                    {
+                        registry->AddComponent<T>(entity, std::move(comp));
                     }
                 }
             );
@@ -206,20 +226,9 @@ namespace Astra
         {
             std::vector<Entity> entityCopy(entities.begin(), entities.end());
             m_componentCommands.emplace_back(
-                [entityCopy = std::move(entityCopy), component, this](Registry* registry)
+                [entityCopy = std::move(entityCopy), component](Registry* registry) mutable
                 {
-                    // Resolve all entity IDs
-                    SmallVector<Entity, 256> resolvedEntities;
-                    resolvedEntities.reserve(entityCopy.size());
-                    for (Entity e : entityCopy)
-                    {
-                        Entity resolved = m_baseExecutor.ResolveEntity(e);
-                        if (resolved != Entity::Invalid())
-                        {
-                            resolvedEntities.push_back(resolved);
-                        }
-                    }
-                    registry->AddComponents<T>(resolvedEntities, component);
+                    registry->AddComponents<T>(entityCopy, component);
                 }
             );
         }
@@ -234,20 +243,9 @@ namespace Astra
         {
             std::vector<Entity> entityCopy(entities.begin(), entities.end());
             m_componentCommands.emplace_back(
-                [entityCopy = std::move(entityCopy), this](Registry* registry)
+                [entityCopy = std::move(entityCopy)](Registry* registry) mutable
                 {
-                    // Resolve all entity IDs
-                    SmallVector<Entity, 256> resolvedEntities;
-                    resolvedEntities.reserve(entityCopy.size());
-                    for (Entity e : entityCopy)
-                    {
-                        Entity resolved = m_baseExecutor.ResolveEntity(e);
-                        if (resolved != Entity::Invalid())
-                        {
-                            resolvedEntities.push_back(resolved);
-                        }
-                    }
-                    registry->RemoveComponents<T>(resolvedEntities);
+                    registry->RemoveComponents<T>(entityCopy);
                 }
             );
         }
@@ -256,8 +254,8 @@ namespace Astra
         
         /**
          * Record a command to set a parent-child relationship
-         * @param child Child entity (can be temporary or real)
-         * @param parent Parent entity (can be temporary or real)
+         * @param child Child entity (can be recorded in this buffer or already live)
+         * @param parent Parent entity (can be recorded in this buffer or already live)
          */
         void SetParent(Entity child, Entity parent)
         {
@@ -266,7 +264,7 @@ namespace Astra
         
         /**
          * Record a command to remove parent from a child
-         * @param child Child entity (can be temporary or real)
+         * @param child Child entity (can be recorded in this buffer or already live)
          */
         void RemoveParent(Entity child)
         {
@@ -275,8 +273,8 @@ namespace Astra
         
         /**
          * Record a command to add a bidirectional link between entities
-         * @param a First entity (can be temporary or real)
-         * @param b Second entity (can be temporary or real)
+         * @param a First entity (can be recorded in this buffer or already live)
+         * @param b Second entity (can be recorded in this buffer or already live)
          */
         void AddLink(Entity a, Entity b)
         {
@@ -285,8 +283,8 @@ namespace Astra
         
         /**
          * Record a command to remove a bidirectional link between entities
-         * @param a First entity (can be temporary or real)
-         * @param b Second entity (can be temporary or real)
+         * @param a First entity (can be recorded in this buffer or already live)
+         * @param b Second entity (can be recorded in this buffer or already live)
          */
         void RemoveLink(Entity a, Entity b)
         {
@@ -302,8 +300,7 @@ namespace Astra
          */
         void Execute(bool clearAfterExecution = true)
         {
-            // Execute base commands first (entities, relationships)
-            // Don't clear base storage yet since we need the remapping for component commands
+            // Execute base commands first so recorded entities exist before their components are added
             m_baseExecutor.Execute(m_baseStorage, false);
             
             // Execute component commands
@@ -317,21 +314,28 @@ namespace Astra
             {
                 Clear();
             }
-            else
-            {
-                // Still need to clear the remapping for consistency
-                m_baseExecutor.ClearRemapping();
-            }
         }
         
         /**
          * Clear all recorded commands without executing
+         * Entities recorded but never executed, and handles reserved but never recorded,
+         * are released back to the registry
          */
         void Clear()
         {
+            for (const auto& cmd : m_baseStorage.GetCommandsOfType<Commands::CreateEntity>())
+            {
+                m_registry->ReleaseReservedEntity(cmd.entity);
+            }
+            for (size_t i = m_reserveNext; i < m_reserveBlock.size(); ++i)
+            {
+                m_registry->ReleaseReservedEntity(m_reserveBlock[i]);
+            }
+            m_reserveBlock.clear();
+            m_reserveNext = 0;
+            
             m_baseStorage.Clear();
             m_componentCommands.clear();
-            m_baseExecutor.ClearRemapping();
         }
         
         /**
@@ -415,6 +419,7 @@ namespace Astra
      * 
      * @note ParallelCommandBuffer is designed to be used with lambda capture,
      *       not static access, to avoid issues with nested parallel regions.
+     * @note Like CommandBuffer, it must not outlive its registry.
      */
     class ParallelCommandBuffer
     {
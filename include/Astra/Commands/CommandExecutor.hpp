@@ -3,7 +3,6 @@
 #include "CommandTypes.hpp"
 #include "CommandStorage.hpp"
 #include "../Registry/Registry.hpp"
-#include "../Container/FlatMap.hpp"
 #include <tuple>
 #include <type_traits>
 
@@ -19,9 +18,6 @@ namespace Astra::Commands
     private:
         Registry* m_registry;
         
-        // Map temporary entity IDs to real entity IDs for deferred entity creation
-        FlatMap<Entity, Entity> m_entityRemapping;
-        
     public:
         explicit CommandExecutor(Registry* registry)
             : m_registry(registry)
@@ -45,9 +41,6 @@ namespace Astra::Commands
                 ExecuteCommandAtIndex(commands, entry.typeIndex, entry.commandIndex);
             }
             
-            // Clear entity remapping after execution
-            m_entityRemapping.Clear();
-            
             // Clear storage by default for reuse
             if (clearAfterExecution)
             {
@@ -55,41 +48,6 @@ namespace Astra::Commands
             }
         }
         
-        /**
-         * Get the number of entities in the remapping table
-         * Used for debugging and statistics
-         */
-        [[nodiscard]] size_t GetRemappingCount() const noexcept
-        {
-            return m_entityRemapping.Size();
-        }
-        
-        /**
-         * Clear the entity remapping table
-         * Call this if you want to reset without executing
-         */
-        void ClearRemapping()
-        {
-            m_entityRemapping.Clear();
-        }
-        
-        /**
-         * Resolve a potentially temporary entity ID to a real entity ID
-         * @param entity The entity to resolve (may be temporary or real)
-         * @return The real entity ID, or Invalid if not found
-         */
-        Entity ResolveEntity(Entity entity) const
-        {
-            // Check if this is a temporary entity that needs remapping
-            if (auto it = m_entityRemapping.Find(entity); it != m_entityRemapping.end())
-            {
-                return it->second;
-            }
-            
-            // Otherwise assume it's a real entity
-            return entity;
-        }
-        
     private:
         // Execute a specific command by type index and command index
         void ExecuteCommandAtIndex(auto& commands, uint16_t typeIndex, uint32_t commandIndex)
@@ -119,20 +77,13 @@ namespace Astra::Commands
         
         void ExecuteCommand(const CreateEntity& cmd)
         {
-            Entity realEntity = m_registry->CreateEntity();
-            if (cmd.tempEntity != Entity::Invalid())
-            {
-                m_entityRemapping[cmd.tempEntity] = realEntity;
-            }
+            // The handle was reserved at record time, playback only brings it to life
+            m_registry->CreateReservedEntity(cmd.entity);
         }
         
         void ExecuteCommand(const DestroyEntity& cmd)
         {
-            Entity entity = ResolveEntity(cmd.entity);
-            if (entity != Entity::Invalid())
-            {
-                m_registry->DestroyEntity(entity);
-            }
+            m_registry->DestroyEntity(cmd.entity);
         }
         
         void ExecuteCommand(const CreateEntities& cmd)
@@ -141,145 +92,77 @@ namespace Astra::Commands
             m_registry->CreateEntities(cmd.count, std::span<Entity>(cmd.outEntities, cmd.count));
         }
         
-        void ExecuteCommand(const DestroyEntities& cmd)
+        void ExecuteCommand(DestroyEntities& cmd)
         {
-            // Resolve entity IDs and destroy
-            SmallVector<Entity, 256> resolvedEntities;
-            resolvedEntities.reserve(cmd.entities.size());
-            
-            for (Entity e : cmd.entities)
-            {
-                Entity resolved = ResolveEntity(e);
-                if (resolved != Entity::Invalid())
-                {
-                    resolvedEntities.push_back(resolved);
-                }
-            }
-            
-            m_registry->DestroyEntities(resolvedEntities);
+            m_registry->DestroyEntities(cmd.entities);
         }
         
         // ============= Component Command Execution =============
+        // Handles are real entities, the registry rejects stale ones
         
         template<typename T>
         void ExecuteCommand(const AddComponent<T>& cmd)
         {
-            Entity entity = ResolveEntity(cmd.entity);
-            if (entity != Entity::Invalid())
-            {
-                m_registry->AddComponent<T>(entity, cmd.component);
-            }
+            m_registry->AddComponent<T>(cmd.entity, cmd.component);
         }
         
         template<typename T>
         void ExecuteCommand(const RemoveComponent<T>& cmd)
         {
-            Entity entity = ResolveEntity(cmd.entity);
-            if (entity != Entity::Invalid())
-            {
-                m_registry->RemoveComponent<T>(entity);
-            }
+            m_registry->RemoveComponent<T>(cmd.entity);
         }
         
         template<typename T>
         void ExecuteCommand(const SetComponent<T>& cmd)
         {
-            Entity entity = ResolveEntity(cmd.entity);
-            if (entity != Entity::Invalid())
+            if (!m_registry->IsValid(cmd.entity))
             {
-                if (T* component = m_registry->GetComponent<T>(entity))
-                {
-                    *component = cmd.component;
-                }
-                else
-                {
-                    // If component doesn't exist, add it
-                    m_registry->AddComponent<T>(entity, cmd.component);
-                }
+                return;
+            }
+            
+            if (T* component = m_registry->GetComponent<T>(cmd.entity))
+            {
+                *component = cmd.component;
+            }
+            else
+            {
+                // If component doesn't exist, add it
+                m_registry->AddComponent<T>(cmd.entity, cmd.component);
             }
         }
         
         template<typename T>
-        void ExecuteCommand(const AddComponents<T>& cmd)
+        void ExecuteCommand(AddComponents<T>& cmd)
         {
-            // Resolve entity IDs
-            SmallVector<Entity, 256> resolvedEntities;
-            resolvedEntities.reserve(cmd.entities.size());
-            
-            for (Entity e : cmd.entities)
-            {
-                Entity resolved = ResolveEntity(e);
-                if (resolved != Entity::Invalid())
-                {
-                    resolvedEntities.push_back(resolved);
-                }
-            }
-            
-            m_registry->AddComponents<T>(resolvedEntities, cmd.component);
+            m_registry->AddComponents<T>(cmd.entities, cmd.component);
         }
         
         template<typename T>
-        void ExecuteCommand(const RemoveComponents<T>& cmd)
+        void ExecuteCommand(RemoveComponents<T>& cmd)
         {
-            // Resolve entity IDs
-            SmallVector<Entity, 256> resolvedEntities;
-            resolvedEntities.reserve(cmd.entities.size());
-            
-            for (Entity e : cmd.entities)
-            {
-                Entity resolved = ResolveEntity(e);
-                if (resolved != Entity::Invalid())
-                {
-                    resolvedEntities.push_back(resolved);
-                }
-            }
-            
-            m_registry->RemoveComponents<T>(resolvedEntities);
+            m_registry->RemoveComponents<T>(cmd.entities);
         }
         
         // ============= Relationship Command Execution =============
         
         void ExecuteCommand(const SetParent& cmd)
         {
-            Entity child = ResolveEntity(cmd.child);
-            Entity parent = ResolveEntity(cmd.parent);
-            
-            if (child != Entity::Invalid() && parent != Entity::Invalid())
-            {
-                m_registry->SetParent(child, parent);
-            }
+            m_registry->SetParent(cmd.child, cmd.parent);
         }
         
         void ExecuteCommand(const RemoveParent& cmd)
         {
-            Entity child = ResolveEntity(cmd.child);
-            
-            if (child != Entity::Invalid())
-            {
-                m_registry->RemoveParent(child);
-            }
+            m_registry->RemoveParent(cmd.child);
         }
         
         void ExecuteCommand(const AddLink& cmd)
         {
-            Entity a = ResolveEntity(cmd.a);
-            Entity b = ResolveEntity(cmd.b);
-            
-            if (a != Entity::Invalid() && b != Entity::Invalid())
-            {
-                m_registry->AddLink(a, b);
-            }
+            m_registry->AddLink(cmd.a, cmd.b);
         }
         
         void ExecuteCommand(const RemoveLink& cmd)
         {
-            Entity a = ResolveEntity(cmd.a);
-            Entity b = ResolveEntity(cmd.b);
-            
-            if (a != Entity::Invalid() && b != Entity::Invalid())
-            {
-                m_registry->RemoveLink(a, b);
-            }
+            m_registry->RemoveLink(cmd.a, cmd.b);
         }
         
     };
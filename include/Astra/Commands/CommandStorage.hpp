@@ -144,6 +144,16 @@ namespace Astra
                 return std::get<std::vector<Cmd>>(m_commands).size();
             }
             
+            /**
+             * Get all stored commands of a specific type
+             * @tparam Cmd The command type to get
+             */
+            template<typename Cmd>
+            [[nodiscard]] const std::vector<Cmd>& GetCommandsOfType() const noexcept
+            {
+                return std::get<std::vector<Cmd>>(m_commands);
+            }
+            
             /**
              * Check if storage is empty
              */
@@ -211,6 +221,7 @@ namespace Astra
                         std::make_move_iterator(otherVec.begin()),
                         std::make_move_iterator(otherVec.end())
                     );
+                    otherVec.clear();
                     
                     MergeImpl<I + 1>(std::move(other));
                 }
@@ -15,7 +15,7 @@ namespace Astra::Commands
      */
     struct CreateEntity
     {
-        Entity tempEntity;  // Temporary/placeholder entity ID
+        Entity entity;  // Handle reserved when the command was recorded
     };
     
     /**
@@ -16,6 +16,7 @@
 
 #include "../Core/Base.hpp"
 #include "../Entity/Entity.hpp"
+#include "../Platform/CpuDispatch.hpp"
 #include "../Platform/Simd.hpp"
 #include "Swiss.hpp"
 
@@ -436,17 +437,10 @@ namespace Astra
         {
             if (!m_slots) ASTRA_UNLIKELY return;
             
-            for (SizeType i = 0; i < m_capacity; ++i)
+            for (SizeType i = FindFull(m_groups, m_numGroups, 0); i < m_capacity; i = FindFull(m_groups, m_numGroups, i + 1))
             {
-                SizeType groupIdx = i / GROUP_SIZE;
-                SizeType slotIdx = i % GROUP_SIZE;
-                
-                std::uint8_t meta = m_groups[groupIdx].Get(slotIdx);
-                if (meta != EMPTY && meta != TOMBSTONE) ASTRA_UNLIKELY
-                {
-                    std::allocator_traits<AllocatorType>::destroy(m_alloc, m_slots[i].GetValue());
-                    m_groups[groupIdx].Set(slotIdx, EMPTY);
-                }
+                std::allocator_traits<AllocatorType>::destroy(m_alloc, m_slots[i].GetValue());
+                m_groups[i / GROUP_SIZE].Set(i % GROUP_SIZE, EMPTY);
             }
             m_size = 0;
             m_tombstoneCount = 0;
@@ -751,24 +745,17 @@ namespace Astra
 
             AllocateStorage(newCapacity);
 
-            for (SizeType i = 0; i < oldCapacity; ++i)
+            for (SizeType i = FindFull(oldGroups, oldNumGroups, 0); i < oldCapacity; i = FindFull(oldGroups, oldNumGroups, i + 1))
             {
-                SizeType groupIdx = i / GROUP_SIZE;
-                SizeType slotIdx = i % GROUP_SIZE;
-
-                std::uint8_t meta = oldGroups[groupIdx].Get(slotIdx);
-                if (meta != EMPTY && meta != TOMBSTONE) ASTRA_UNLIKELY
-                {
-                    // Move the entire pair at once
-                    ValueType* oldPair = oldSlots[i].GetValue();
+                // Move the entire pair at once
+                ValueType* oldPair = oldSlots[i].GetValue();
 
-                    // Use placement new to move-construct directly
-                    // This avoids the const issue entirely
-                    Emplace(std::move(oldPair->first), std::move(oldPair->second));
+                // Use placement new to move-construct directly
+                // This avoids the const issue entirely
+                Emplace(std::move(oldPair->first), std::move(oldPair->second));
 
-                    // Now destroy the old pair
-                    std::allocator_traits<AllocatorType>::destroy(m_alloc, oldPair);
-                }
+                // Now destroy the old pair
+                std::allocator_traits<AllocatorType>::destroy(m_alloc, oldPair);
             }
 
             // Destroy old groups before deallocating
@@ -980,6 +967,14 @@ namespace Astra
             }
         };
 
+        // Next full slot at or after start, scanning the control bytes with the widest kernel the
+        // CPU supports; padding bytes past the capacity are always EMPTY
+        static SizeType FindFull(const Group* groups, SizeType numGroups, SizeType start) noexcept
+        {
+            static_assert(sizeof(Group) == GROUP_SIZE, "Control bytes must be contiguous across groups");
+            return static_cast<SizeType>(Simd::Dispatch::FindFull(reinterpret_cast<const std::uint8_t*>(groups), numGroups * GROUP_SIZE, start));
+        }
+
         // Storage for key-value pairs
         struct Slot
         {
@@ -64,9 +64,8 @@ namespace Astra
             else
             {
                 // Use shared_ptr for large functors to enable safe copying
-                auto* heapFunc = new DecayedFunc(std::forward<Func>(func));
-                *reinterpret_cast<std::shared_ptr<DecayedFunc>*>(m_storage) = 
-                    std::shared_ptr<DecayedFunc>(heapFunc);
+                // The storage holds no shared_ptr yet, construct it in place rather than assigning
+                new (m_storage) std::shared_ptr<DecayedFunc>(std::make_shared<DecayedFunc>(std::forward<Func>(func)));
                 m_invoker = &InvokeLargeFunctor<DecayedFunc>;
                 m_manager = &ManageLargeFunctor<DecayedFunc>;
             }
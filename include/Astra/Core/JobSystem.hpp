@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "../Platform/Hardware.hpp"
+#include "../Platform/Platform.hpp"
+#include "Base.hpp"
+
+#if defined(ASTRA_PLATFORM_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Astra
+{
+    /**
+     * Persistent pool of worker threads with per-worker deques and work stealing
+     * 
+     * Workers pop their own deque newest-first and steal from the others oldest-first. A thread
+     * that waits on a batch runs queued jobs until the batch is done, so batches can be nested,
+     * e.g. a parallel view iterated inside a system that itself runs on the pool.
+     * 
+     * When exceptions are enabled, the first exception thrown by a job of a batch is rethrown on
+     * the thread that started the batch once its remaining jobs have finished. Jobs a failed
+     * ParallelSpawn job would have spawned never run.
+     * 
+     * Attach one to a Registry with SetJobSystem to run views on it, and pass it to a
+     * JobSystemExecutor to run systems on it.
+     */
+    class JobSystem
+    {
+    public:
+        struct Config
+        {
+            size_t workerCount = 0;     // 0 = one less than the hardware threads, the caller is the last one
+            bool pinWorkers = false;    // Pin worker i to core i + 1 where the platform supports it
+        };
+        
+        JobSystem() : JobSystem(Config{}) {}
+        
+        explicit JobSystem(const Config& config)
+        {
+            size_t workerCount = config.workerCount;
+            if (workerCount == 0)
+            {
+                const size_t hardwareThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+                workerCount = std::max<size_t>(1, hardwareThreads - 1);
+            }
+            
+            m_queues.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                m_queues.push_back(std::make_unique<WorkQueue>());
+            }
+            
+            m_workers.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+                if (config.pinWorkers)
+                {
+                    PinThread(m_workers.back(), i + 1);
+                }
+            }
+        }
+        
+        ~JobSystem()
+        {
+            {
+                std::lock_guard lock(m_sleepMutex);
+                m_stopping = true;
+            }
+            m_wake.notify_all();
+            
+            for (auto& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+        
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        
+        ASTRA_NODISCARD size_t GetWorkerCount() const noexcept { return m_workers.size(); }
+        
+        /**
+         * Run func(i) for every i in [0, count) and wait for all of them
+         * The calling thread runs jobs too, so this never deadlocks when called from a job
+         */
+        template<typename Func>
+        void ParallelFor(size_t count, Func&& func)
+        {
+            if (count == 0)
+                return;
+            
+            if (count == 1)
+            {
+                func(size_t(0));
+                return;
+            }
+            
+            Batch batch;
+            batch.context = &func;
+            batch.invoke = [](void* context, size_t index) { (*static_cast<std::remove_reference_t<Func>*>(context))(index); };
+            batch.pending.store(count, std::memory_order_relaxed);
+            
+            // The caller takes index 0 itself, the rest are spread round robin over the workers
+            const size_t queueCount = m_queues.size();
+            const size_t self = CurrentWorker();
+            const size_t start = self != NOT_A_WORKER ? self : m_nextQueue.fetch_add(1, std::memory_order_relaxed);
+            for (size_t i = 1; i < count; ++i)
+            {
+                Enqueue((start + i) % queueCount, Job{&batch, i});
+            }
+            m_queuedJobs.fetch_add(count - 1, std::memory_order_release);
+            WakeWorkers(count - 1);
+            
+            RunJob(Job{&batch, 0});
+            WaitFor(batch, self);
+            RethrowFailure(batch);
+        }
+        
+        /**
+         * Run func(i, spawn) for count indices that are queued while the batch runs
+         * 
+         * Starts with roots and returns once every queued job has finished, count of them in all.
+         * A job queues further indices of the same batch with spawn(i); each index must be
+         * queued exactly once.
+         * Workers run their own newest job first and steal the oldest, so both the roots and the
+         * indices one job spawns should be passed lowest priority first.
+         */
+        template<typename Func>
+        void ParallelSpawn(size_t count, std::span<const size_t> roots, Func&& func)
+        {
+            if (count == 0)
+                return;
+            
+            ASTRA_ASSERT(!roots.empty(), "A spawned batch needs at least one root");
+            
+            Batch batch;
+            auto spawn = [this, &batch](size_t index)
+            {
+                const size_t self = CurrentWorker();
+                const size_t queue = self != NOT_A_WORKER ? self : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+                // The spawning job is still pending, so the count cannot reach zero in between
+                batch.pending.fetch_add(1, std::memory_order_relaxed);
+                Enqueue(queue, Job{&batch, index});
+                m_queuedJobs.fetch_add(1, std::memory_order_release);
+                WakeWorkers(1);
+            };
+            auto invoke = [&func, &spawn](size_t index) { func(index, spawn); };
+            
+            batch.context = &invoke;
+            batch.invoke = [](void* context, size_t index) { (*static_cast<decltype(invoke)*>(context))(index); };
+            batch.pending.store(roots.size(), std::memory_order_relaxed);
+            
+            // Roots are dealt out round robin so they start on different workers
+            const size_t queueCount = m_queues.size();
+            const size_t start = m_nextQueue.fetch_add(1, std::memory_order_relaxed);
+            for (size_t i = 0; i < roots.size(); ++i)
+            {
+                Enqueue((start + i) % queueCount, Job{&batch, roots[i]});
+            }
+            m_queuedJobs.fetch_add(roots.size(), std::memory_order_release);
+            WakeWorkers(roots.size());
+            
+            WaitFor(batch, CurrentWorker());
+            RethrowFailure(batch);
+        }
+    
+    private:
+        struct Batch
+        {
+            void* context = nullptr;
+            void (*invoke)(void*, size_t) = nullptr;
+            // Jobs queued or running. The batch is done at zero, which is the last thing a job touches:
+            // the waiter returns and destroys the batch right after
+            std::atomic<size_t> pending{0};
+#if defined(__cpp_exceptions)
+            std::atomic<bool> failed{false};
+            std::exception_ptr failure;
+#endif
+        };
+        
+        struct Job
+        {
+            Batch* batch;
+            size_t index;
+        };
+        
+        struct alignas(CACHE_LINE_SIZE) WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+        
+        static constexpr size_t NOT_A_WORKER = static_cast<size_t>(-1);
+        
+        // Queue index of the calling thread if it is one of this pool's workers
+        size_t CurrentWorker() const noexcept
+        {
+            return t_workerPool == this ? t_workerIndex : NOT_A_WORKER;
+        }
+        
+        void Enqueue(size_t queue, const Job& job)
+        {
+            WorkQueue& target = *m_queues[queue];
+            std::lock_guard lock(target.mutex);
+            target.jobs.push_back(job);
+        }
+        
+        // Wake one sleeping worker per queued job, busy workers find the jobs on their own
+        void WakeWorkers(size_t jobs)
+        {
+            {
+                std::lock_guard lock(m_sleepMutex);
+            }
+            
+            if (jobs >= m_workers.size())
+            {
+                m_wake.notify_all();
+                return;
+            }
+            for (size_t i = 0; i < jobs; ++i)
+            {
+                m_wake.notify_one();
+            }
+        }
+        
+        // Help with queued work until every job of the batch has finished
+        void WaitFor(const Batch& batch, size_t self)
+        {
+            while (batch.pending.load(std::memory_order_acquire) != 0)
+            {
+                if (!TryRunOne(self))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        
+        static void RunJob(const Job& job)
+        {
+            Batch* batch = job.batch;
+#if defined(__cpp_exceptions)
+            try
+            {
+                batch->invoke(batch->context, job.index);
+            }
+            catch (...)
+            {
+                // Only the first failure is kept, the flag hands out ownership of the slot
+                if (!batch->failed.exchange(true, std::memory_order_acq_rel))
+                {
+                    batch->failure = std::current_exception();
+                }
+            }
+#else
+            batch->invoke(batch->context, job.index);
+#endif
+            // Last access, the batch may be gone once this returns
+            batch->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        
+        static void RethrowFailure(Batch& batch)
+        {
+#if defined(__cpp_exceptions)
+            if (batch.failed.load(std::memory_order_acquire))
+            {
+                std::rethrow_exception(batch.failure);
+            }
+#else
+            (void)batch;
+#endif
+        }
+        
+        // Pops the newest job of the own queue, or steals the oldest job of another queue
+        bool TryRunOne(size_t self)
+        {
+            if (m_queuedJobs.load(std::memory_order_acquire) == 0)
+                return false;
+            
+            const size_t queueCount = m_queues.size();
+            if (self < queueCount)
+            {
+                WorkQueue& own = *m_queues[self];
+                std::unique_lock lock(own.mutex);
+                if (!own.jobs.empty())
+                {
+                    Job job = own.jobs.back();
+                    own.jobs.pop_back();
+                    lock.unlock();
+                    m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                    RunJob(job);
+                    return true;
+                }
+            }
+            
+            const size_t first = self < queueCount ? self + 1 : 0;
+            for (size_t n = 0; n < queueCount; ++n)
+            {
+                WorkQueue& victim = *m_queues[(first + n) % queueCount];
+                std::unique_lock lock(victim.mutex, std::try_to_lock);
+                if (!lock.owns_lock() || victim.jobs.empty())
+                    continue;
+                
+                Job job = victim.jobs.front();
+                victim.jobs.pop_front();
+                lock.unlock();
+                m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                RunJob(job);
+                return true;
+            }
+            return false;
+        }
+        
+        void WorkerLoop(size_t index)
+        {
+            t_workerPool = this;
+            t_workerIndex = index;
+            while (true)
+            {
+                if (TryRunOne(index))
+                    continue;
+                
+                std::unique_lock lock(m_sleepMutex);
+                m_wake.wait(lock, [this]() { return m_stopping || m_queuedJobs.load(std::memory_order_acquire) != 0; });
+                if (m_stopping)
+                    return;
+            }
+        }
+        
+        static void PinThread(std::thread& thread, size_t core)
+        {
+#if defined(ASTRA_PLATFORM_LINUX)
+            const size_t hardwareThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core % hardwareThreads, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+            (void)thread;
+            (void)core;
+#endif
+        }
+        
+        std::vector<std::unique_ptr<WorkQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<size_t> m_queuedJobs{0};
+        std::atomic<size_t> m_nextQueue{0};
+        
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wake;
+        bool m_stopping = false;
+        
+        // Pool and queue of the worker running on this thread, null pool on other threads
+        inline static thread_local const JobSystem* t_workerPool = nullptr;
+        inline static thread_local size_t t_workerIndex = NOT_A_WORKER;
+    };
+}
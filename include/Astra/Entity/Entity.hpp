@@ -34,6 +34,7 @@ namespace Astra
         public:
             using IDType = typename Traits::IDType;
             using VersionType = typename Traits::VersionType;
+            using IndexType = typename Traits::IndexType;
 
             static constexpr auto ID_MASK       = Traits::ID_MASK;
             static constexpr auto VERSION_MASK  = Traits::VERSION_MASK;
@@ -99,6 +100,9 @@ namespace Astra
                                 std::conditional_t<VersionBits <= 16, std::uint16_t, std::uint32_t>>;
 
         static constexpr std::size_t ID_BITS = TotalBits - VersionBits;
+
+        // Narrowest type holding a bare ID, used by side tables that store IDs without versions
+        using IndexType = std::conditional_t<ID_BITS <= 32, std::uint32_t, std::uint64_t>;
         static constexpr std::size_t VERSION_SHIFT = ID_BITS;
         static constexpr IDType ID_MASK = (IDType{1} << ID_BITS) - 1;
         static constexpr IDType VERSION_MASK = (IDType{1} << VersionBits) - 1;
@@ -108,7 +112,16 @@ namespace Astra
     using EntityTraits32 = EntityTraits<32, 8>;   // 8-bit version, 24-bit ID
     using EntityTraits64 = EntityTraits<64, 32>;  // 32-bit version, 32-bit ID
 
+    // Define ASTRA_ENTITY_64 to widen handles to 64 bits. This lifts the ID space from ~16.7M to ~4.3B
+    // and makes stale handles practically unaliasable, at the cost of doubling handle and version storage.
+#ifdef ASTRA_ENTITY_64
+    using Entity = Detail::BasicEntity<EntityTraits64>;
+#else
     using Entity = Detail::BasicEntity<EntityTraits32>;
+#endif
+
+    // Width of an entity handle in bits, recorded in serialized archives
+    constexpr std::size_t ENTITY_BITS = sizeof(Entity::IDType) * 8;
 
 #ifndef ASTRA_MAX_ENTITIES
     #define ASTRA_MAX_ENTITIES (Entity::ID_MASK + 1)
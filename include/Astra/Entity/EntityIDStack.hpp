@@ -1,33 +1,48 @@
 #pragma once
 
+#include <atomic>
+#include <bit>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <vector>
 
-#include "../Container/SmallVector.hpp"
 #include "../Core/Base.hpp"
+#include "../Platform/Simd.hpp"
 #include "Entity.hpp"
 
 namespace Astra
 {
+    // Hands out the lowest free ID first. Free IDs are tracked in per-page bitmaps with a page summary
+    // bitmap on top, so live IDs stay packed in the low EntityTable segments and high segments can drain
+    // and be released instead of being pinned by scattered LIFO reuse. Reuse versions are kept in one
+    // small block per bitmap word with free IDs, so a scattered free list stays cheap. Reservations take
+    // free IDs before fresh ones and keep them marked on their page until they are materialized or released.
     class EntityIDStack
     {
     public:
         using IDType = Entity::IDType;
         using VersionType = Entity::VersionType;
+        using IndexType = Entity::IndexType;
         
         static constexpr IDType INVALID_ID = Entity::ID_MASK;
         static constexpr VersionType NULL_VERSION = 0;
         static constexpr VersionType INITIAL_VERSION = 1;
         
+        static constexpr size_t PAGE_SHIFT = 12;
+        static constexpr size_t PAGE_SIZE = size_t(1) << PAGE_SHIFT;   // IDs tracked per free page
+        static constexpr size_t PAGE_WORDS = PAGE_SIZE / 64;
+        
+        // IDs are stored as IndexType so entries stay 8 bytes with 64-bit handles too
         struct RecycledEntry
         {
-            IDType id;
+            IndexType id;
             VersionType nextVersion;
         };
         
         struct VersionedID
         {
-            IDType id;
+            IndexType id;
             VersionType version;
             
             // Support for structured bindings
@@ -43,19 +58,75 @@ namespace Astra
         
         ASTRA_NODISCARD VersionedID Allocate() noexcept
         {
-            if (!m_recycledIDs.empty())
+            if (m_recycledCount.load(std::memory_order_relaxed) > 0)
             {
-                auto entry = m_recycledIDs.back();
-                m_recycledIDs.pop_back();
+                auto entry = PopLowest();
                 return {entry.id, entry.nextVersion};
             }
             
-            if (m_nextID > Entity::ID_MASK)
+            const IDType id = m_nextID.load(std::memory_order_relaxed);
+            if (id > Entity::ID_MASK)
+            {
+                return {static_cast<IndexType>(INVALID_ID), NULL_VERSION};
+            }
+            
+            m_nextID.store(id + 1, std::memory_order_relaxed);
+            return {static_cast<IndexType>(id), INITIAL_VERSION};
+        }
+        
+        // Claim up to count never-used IDs, safe to call from several threads at once but not
+        // concurrently with the other mutators. Returns the number claimed, starting at outFirst
+        size_t ReserveFresh(size_t count, IDType& outFirst) noexcept
+        {
+            IDType current = m_nextID.load(std::memory_order_relaxed);
+            size_t granted;
+            do
             {
-                return {INVALID_ID, NULL_VERSION};
+                if (current > Entity::ID_MASK) ASTRA_UNLIKELY
+                {
+                    return 0;
+                }
+                granted = std::min(count, static_cast<size_t>((Entity::ID_MASK + 1) - current));
             }
+            while (!m_nextID.compare_exchange_weak(current, current + static_cast<IDType>(granted), std::memory_order_relaxed));
             
-            return {m_nextID++, INITIAL_VERSION};
+            outFirst = current;
+            return granted;
+        }
+        
+        // Claim up to count IDs for reservation, lowest free IDs first and fresh ones after that. Safe to call
+        // from several threads at once but not concurrently with the other mutators. Returns the number claimed.
+        // Free IDs are popped under a lock taken once per call; with none left, reservers only race on the
+        // fresh ID counter. The free set cannot grow while reservations run, so an empty one stays empty
+        template<typename OutputIt>
+        size_t ReserveBatch(size_t count, OutputIt out) noexcept
+        {
+            size_t fromRecycled = 0;
+            if (m_recycledCount.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_reserveMutex);
+                
+                fromRecycled = std::min(count, m_recycledCount.load(std::memory_order_relaxed));
+                for (size_t i = 0; i < fromRecycled; ++i)
+                {
+                    auto entry = PopLowest(true);
+                    *out++ = VersionedID{entry.id, entry.nextVersion};
+                }
+                
+                if (fromRecycled == count)
+                {
+                    return count;
+                }
+            }
+            
+            IDType first = 0;
+            const size_t fresh = ReserveFresh(count - fromRecycled, first);
+            for (size_t i = 0; i < fresh; ++i)
+            {
+                *out++ = VersionedID{static_cast<IndexType>(first + i), INITIAL_VERSION};
+            }
+            
+            return fromRecycled + fresh;
         }
         
         template<typename OutputIt>
@@ -64,26 +135,25 @@ namespace Astra
             size_t allocated = 0;
             
             // First, use recycled IDs
-            size_t fromRecycled = std::min(count, m_recycledIDs.size());
+            size_t fromRecycled = std::min(count, m_recycledCount.load(std::memory_order_relaxed));
             for (size_t i = 0; i < fromRecycled; ++i)
             {
-                auto entry = m_recycledIDs.back();
-                m_recycledIDs.pop_back();
+                auto entry = PopLowest();
                 *out++ = VersionedID{entry.id, entry.nextVersion};
                 ++allocated;
             }
             
             // Then allocate fresh IDs
             size_t remaining = count - fromRecycled;
-            size_t availableFresh = (Entity::ID_MASK + 1) - m_nextID;
+            IDType startID = m_nextID.load(std::memory_order_relaxed);
+            size_t availableFresh = (Entity::ID_MASK + 1) - startID;
             size_t toAllocate = std::min(remaining, availableFresh);
             
-            IDType startID = m_nextID;
-            m_nextID += static_cast<IDType>(toAllocate);
+            m_nextID.store(startID + static_cast<IDType>(toAllocate), std::memory_order_relaxed);
             
             for (size_t i = 0; i < toAllocate; ++i)
             {
-                *out++ = VersionedID{startID + static_cast<IDType>(i), INITIAL_VERSION};
+                *out++ = VersionedID{static_cast<IndexType>(startID + i), INITIAL_VERSION};
                 ++allocated;
             }
             
@@ -93,88 +163,300 @@ namespace Astra
         void Recycle(IDType id, VersionType nextVersion) noexcept
         {
             ASTRA_ASSERT(id <= Entity::ID_MASK, "Invalid ID for recycling");
-            m_recycledIDs.push_back({id, nextVersion});
+            Push(static_cast<IndexType>(id), nextVersion);
         }
         
         void Recycle(IDType id, VersionType nextVersion, bool) noexcept
         {
-            Recycle(id, nextVersion);  // Ignore preferLocal in simple design
+            Recycle(id, nextVersion);  // Lowest-first reuse already keeps IDs local
         }
         
         template<typename InputIt>
         void RecycleBatch(InputIt first, InputIt last)
         {
-            size_t count = std::distance(first, last);
-            m_recycledIDs.reserve(m_recycledIDs.size() + count);
-            
             for (auto it = first; it != last; ++it)
             {
-                m_recycledIDs.push_back(*it);
+                Push(it->id, it->nextVersion);
             }
         }
         
         ASTRA_NODISCARD size_t RecycledCount() const noexcept
         {
-            return m_recycledIDs.size();
+            return m_recycledCount.load(std::memory_order_relaxed);
+        }
+        
+        // Pages currently holding free IDs, a page is released once all of its IDs are reused
+        ASTRA_NODISCARD size_t FreePageCount() const noexcept
+        {
+            size_t count = 0;
+            for (const uint64_t word : m_pageMask)
+            {
+                count += static_cast<size_t>(std::popcount(word));
+            }
+            return count;
         }
         
         ASTRA_NODISCARD bool HasAvailable() const noexcept
         {
-            return !m_recycledIDs.empty() || m_nextID <= Entity::ID_MASK;
+            return m_recycledCount.load(std::memory_order_relaxed) > 0 || m_nextID.load(std::memory_order_relaxed) <= Entity::ID_MASK;
+        }
+        
+        ASTRA_NODISCARD bool IsFree(IDType id) const noexcept
+        {
+            const size_t pageIdx = static_cast<size_t>(id) >> PAGE_SHIFT;
+            if (pageIdx >= m_pages.size() || !m_pages[pageIdx])
+            {
+                return false;
+            }
+            
+            const size_t local = static_cast<size_t>(id) & (PAGE_SIZE - 1);
+            return (m_pages[pageIdx]->bits[local / 64] >> (local % 64)) & 1;
+        }
+        
+        // True when id was reserved out of the free set, outVersion is the version it was handed out with
+        ASTRA_NODISCARD bool FindReserved(IDType id, VersionType& outVersion) const noexcept
+        {
+            const size_t pageIdx = static_cast<size_t>(id) >> PAGE_SHIFT;
+            if (pageIdx >= m_pages.size() || !m_pages[pageIdx])
+            {
+                return false;
+            }
+            
+            const FreePage& page = *m_pages[pageIdx];
+            const size_t local = static_cast<size_t>(id) & (PAGE_SIZE - 1);
+            if (((page.reserved[local / 64] >> (local % 64)) & 1) == 0)
+            {
+                return false;
+            }
+            
+            outVersion = page.versions[local / 64]->nextVersions[local % 64];
+            return true;
+        }
+        
+        // Forget a reservation taken from the free set once it is materialized or recycled
+        void EndReservation(IDType id) noexcept
+        {
+            const size_t pageIdx = static_cast<size_t>(id) >> PAGE_SHIFT;
+            ASTRA_ASSERT(pageIdx < m_pages.size() && m_pages[pageIdx], "ID was not reserved from the free set");
+            
+            FreePage& page = *m_pages[pageIdx];
+            const size_t local = static_cast<size_t>(id) & (PAGE_SIZE - 1);
+            const size_t word = local / 64;
+            page.reserved[word] &= ~(uint64_t(1) << (local % 64));
+            
+            if (page.bits[word] == 0 && page.reserved[word] == 0)
+            {
+                page.versions[word].reset();
+            }
+            
+            if (--page.reservedCount == 0 && page.freeCount == 0)
+            {
+                m_pages[pageIdx].reset();
+            }
         }
         
         void Reserve(size_t capacity)
         {
-            m_recycledIDs.reserve(capacity);
+            const size_t pages = (capacity + PAGE_SIZE - 1) >> PAGE_SHIFT;
+            m_pages.reserve(pages);
+            m_pageMask.reserve((pages + 63) / 64);
         }
         
-        void HintDestroyCount(size_t count)
+        void HintDestroyCount(size_t)
         {
-            m_recycledIDs.reserve(m_recycledIDs.size() + count);
+            // Pages are allocated on demand, nothing to pre-size
         }
         
         void Clear() noexcept
         {
-            m_recycledIDs.clear();
-            m_nextID = 0;
+            m_pages.clear();
+            m_pageMask.clear();
+            m_firstMaskWord = 0;
+            m_recycledCount.store(0, std::memory_order_relaxed);
+            m_nextID.store(0, std::memory_order_relaxed);
         }
         
         void ShrinkToFit()
         {
-            m_recycledIDs.shrink_to_fit();
+            while (!m_pages.empty() && !m_pages.back())
+            {
+                m_pages.pop_back();
+            }
+            m_pageMask.resize((m_pages.size() + 63) / 64);
+            m_firstMaskWord = std::min(m_firstMaskWord, m_pageMask.size());
+            
+            m_pages.shrink_to_fit();
+            m_pageMask.shrink_to_fit();
         }
         
+        // Entries come out in ascending ID order
         void GetAllRecycledEntries(std::vector<RecycledEntry>& outEntries) const
         {
             outEntries.clear();
-            outEntries.reserve(m_recycledIDs.size());
-            outEntries.insert(outEntries.end(), m_recycledIDs.begin(), m_recycledIDs.end());
+            outEntries.reserve(m_recycledCount.load(std::memory_order_relaxed));
+            
+            for (size_t pageIdx = 0; pageIdx < m_pages.size(); ++pageIdx)
+            {
+                const FreePage* page = m_pages[pageIdx].get();
+                if (!page)
+                {
+                    continue;
+                }
+                
+                for (size_t word = 0; word < PAGE_WORDS; ++word)
+                {
+                    for (uint64_t bits = page->bits[word]; bits != 0; bits &= bits - 1)
+                    {
+                        const size_t local = word * 64 + Simd::Ops::CountTrailingZeros(bits);
+                        outEntries.push_back({static_cast<IndexType>((pageIdx << PAGE_SHIFT) | local), page->versions[word]->nextVersions[local % 64]});
+                    }
+                }
+            }
         }
         
         void RestoreRecycledEntries(const std::vector<RecycledEntry>& entries)
         {
-            m_recycledIDs.clear();
-            m_recycledIDs.reserve(entries.size());
+            m_pages.clear();
+            m_pageMask.clear();
+            m_firstMaskWord = 0;
+            m_recycledCount.store(0, std::memory_order_relaxed);
+            
             for (const auto& entry : entries)
             {
-                m_recycledIDs.push_back(entry);
+                Push(entry.id, entry.nextVersion);
             }
         }
-
+        
         ASTRA_NODISCARD IDType GetNextID() const noexcept
         {
-            return m_nextID;
+            return m_nextID.load(std::memory_order_relaxed);
         }
-
+        
         void SetNextID(IDType id)
         {
-            m_nextID = id;
+            m_nextID.store(id, std::memory_order_relaxed);
         }
 
     private:
-        SmallVector<RecycledEntry, 256> m_recycledIDs;  // 256 entries inline (~1.25KB)
-        IDType m_nextID = 0;
+        // Versions handed out on reuse for the 64 IDs of one bitmap word, valid where the bit is set
+        struct VersionBlock
+        {
+            VersionType nextVersions[64];
+        };
+        
+        struct FreePage
+        {
+            uint64_t bits[PAGE_WORDS] = {};                         // Set bit = ID is free
+            uint64_t reserved[PAGE_WORDS] = {};                     // Set bit = ID is reserved out of the free set
+            std::unique_ptr<VersionBlock> versions[PAGE_WORDS];     // Null where both bit words are zero
+            uint32_t freeCount = 0;
+            uint32_t reservedCount = 0;
+            uint32_t firstWord = PAGE_WORDS;                        // No bits word below this is nonzero
+        };
+        
+        void Push(IndexType id, VersionType nextVersion)
+        {
+            const size_t pageIdx = static_cast<size_t>(id) >> PAGE_SHIFT;
+            const size_t maskWord = pageIdx / 64;
+            
+            if (pageIdx >= m_pages.size()) ASTRA_UNLIKELY
+            {
+                m_pages.resize(pageIdx + 1);
+                m_pageMask.resize(maskWord + 1, 0);
+            }
+            
+            auto& page = m_pages[pageIdx];
+            if (!page) ASTRA_UNLIKELY
+            {
+                page = std::make_unique<FreePage>();
+            }
+            
+            if (page->freeCount == 0)
+            {
+                m_pageMask[maskWord] |= uint64_t(1) << (pageIdx % 64);
+                if (maskWord < m_firstMaskWord || m_recycledCount.load(std::memory_order_relaxed) == 0)
+                {
+                    m_firstMaskWord = maskWord;
+                }
+            }
+            
+            const size_t local = static_cast<size_t>(id) & (PAGE_SIZE - 1);
+            const uint32_t word = static_cast<uint32_t>(local / 64);
+            const uint64_t bit = uint64_t(1) << (local % 64);
+            ASTRA_ASSERT((page->bits[word] & bit) == 0, "ID recycled twice");
+            
+            auto& versions = page->versions[word];
+            if (!versions) ASTRA_UNLIKELY
+            {
+                versions = std::make_unique<VersionBlock>();
+            }
+            
+            page->bits[word] |= bit;
+            versions->nextVersions[local % 64] = nextVersion;
+            page->firstWord = std::min(page->firstWord, word);
+            ++page->freeCount;
+            m_recycledCount.store(m_recycledCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        
+        // With reserve the ID stays marked on its page, together with its version, until EndReservation
+        RecycledEntry PopLowest(bool reserve = false) noexcept
+        {
+            ASTRA_ASSERT(m_recycledCount.load(std::memory_order_relaxed) > 0, "No recycled IDs");
+            
+            while (m_pageMask[m_firstMaskWord] == 0)
+            {
+                ++m_firstMaskWord;
+            }
+            
+            const uint64_t pageBits = m_pageMask[m_firstMaskWord];
+            const size_t pageIdx = m_firstMaskWord * 64 + Simd::Ops::CountTrailingZeros(pageBits);
+            FreePage& page = *m_pages[pageIdx];
+            
+            while (page.bits[page.firstWord] == 0)
+            {
+                ++page.firstWord;
+            }
+            
+            uint64_t& bits = page.bits[page.firstWord];
+            const size_t bit = Simd::Ops::CountTrailingZeros(bits);
+            const size_t local = page.firstWord * 64 + bit;
+            bits &= bits - 1;
+            
+            RecycledEntry entry{static_cast<IndexType>((pageIdx << PAGE_SHIFT) | local), page.versions[page.firstWord]->nextVersions[bit]};
+            m_recycledCount.store(m_recycledCount.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            
+            if (reserve)
+            {
+                page.reserved[page.firstWord] |= uint64_t(1) << bit;
+                ++page.reservedCount;
+            }
+            else if (bits == 0 && page.reserved[page.firstWord] == 0)
+            {
+                page.versions[page.firstWord].reset();
+            }
+            
+            // Drop pages without free or reserved IDs so fully live ranges cost nothing
+            if (--page.freeCount == 0)
+            {
+                m_pageMask[m_firstMaskWord] &= pageBits - 1;
+                if (page.reservedCount == 0)
+                {
+                    m_pages[pageIdx].reset();
+                }
+            }
+            
+            return entry;
+        }
+        
+        std::vector<std::unique_ptr<FreePage>> m_pages;    // Indexed by id >> PAGE_SHIFT, null without free IDs
+        std::vector<uint64_t> m_pageMask;                   // Bit per page holding free IDs
+        size_t m_firstMaskWord = 0;                         // No m_pageMask word below this is nonzero
+        std::atomic<size_t> m_recycledCount{0};             // Written by one thread at a time, read by reservers
+        std::atomic<IDType> m_nextID{0};                    // Only ReserveFresh may race with itself
+        std::mutex m_reserveMutex;                          // Serializes reservers popping the free set
     };
+
+    static_assert(sizeof(EntityIDStack::RecycledEntry) <= 8, "Recycled entries should stay compact");
 }
 
 // Template specializations for structured bindings support
@@ -182,10 +464,10 @@ namespace std
 {
     template<>
     struct tuple_size<Astra::EntityIDStack::VersionedID> : std::integral_constant<std::size_t, 2> {};
-    
+
     template<std::size_t I>
     struct tuple_element<I, Astra::EntityIDStack::VersionedID>
     {
-        using type = std::conditional_t<I == 0, Astra::Entity::IDType, Astra::Entity::VersionType>;
+        using type = std::conditional_t<I == 0, Astra::Entity::IndexType, Astra::Entity::VersionType>;
     };
-}
\ No newline at end of file
+}
@@ -4,7 +4,9 @@
 #include <cassert>
 #include <cstdint>
 #include <limits>
+#include <iterator>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "../Container/SmallVector.hpp"
@@ -150,15 +152,13 @@ namespace Astra
             SmallVector<EntityIDStack::RecycledEntry, 256> toRecycle;
             std::size_t destroyed = 0;
             
-            for (auto it = first; it != last; ++it)
+            auto destroyValidated = [&](Entity entity)
             {
-                if (!IsValid(*it)) ASTRA_UNLIKELY continue;
+                const IDType id = entity.GetID();
+                const VersionType currentVersion = entity.GetVersion();
                 
-                IDType id = it->GetID();
-                VersionType currentVersion = it->GetVersion();
-                
-                // Verify version matches
-                if (m_table.GetVersion(id) != currentVersion) ASTRA_UNLIKELY continue;
+                // Destroy returns the previous version, a mismatch means a duplicate handle already destroyed it
+                if (m_table.Destroy(id) != currentVersion) ASTRA_UNLIKELY return;
                 
                 // Calculate next version
                 VersionType nextVersion = currentVersion + 1;
@@ -167,10 +167,33 @@ namespace Astra
                     nextVersion = INITIAL_VERSION;
                 }
                 
-                // Mark as destroyed
-                m_table.Destroy(id);
-                toRecycle.push_back({id, nextVersion});
+                toRecycle.push_back({static_cast<EntityIDStack::IndexType>(id), nextVersion});
                 ++destroyed;
+            };
+            
+            if constexpr (std::contiguous_iterator<InputIt> && std::same_as<std::iter_value_t<InputIt>, Entity>)
+            {
+                // Validate block by block with gathered version lookups, then destroy the survivors
+                const std::span<const Entity> entities(std::to_address(first), estimatedCount);
+                for (size_t base = 0; base < entities.size(); base += EntityTable::BATCH_BLOCK)
+                {
+                    const auto block = entities.subspan(base, std::min(EntityTable::BATCH_BLOCK, entities.size() - base));
+                    uint64_t alive = 0;
+                    m_table.IsAliveBatch(block, &alive);
+                    
+                    while (alive)
+                    {
+                        destroyValidated(block[Simd::Ops::CountTrailingZeros(alive)]);
+                        alive &= alive - 1;
+                    }
+                }
+            }
+            else
+            {
+                for (auto it = first; it != last; ++it)
+                {
+                    if (IsValid(*it)) ASTRA_LIKELY destroyValidated(*it);
+                }
             }
             
             // Batch recycle the IDs
@@ -182,6 +205,88 @@ namespace Astra
             return destroyed;
         }
 
+        // Hand out up to count handles without touching the table, so jobs can name entities before they exist.
+        // Safe to call from many threads at once, but not concurrently with Create/Destroy or other mutators.
+        // Free IDs are reserved before fresh ones, so steady reserve/release churn does not grow the ID range.
+        // Taking free IDs locks once per call, reserving fresh IDs is lock-free.
+        // Reserved handles stay invalid until MaterializeReserved; returns the number reserved
+        template<typename OutputIt>
+        std::size_t ReserveEntities(std::size_t count, OutputIt out) noexcept
+        {
+            SmallVector<EntityIDStack::VersionedID, 256> reservations;
+            reservations.resize(count);
+            const std::size_t reserved = m_idStack.ReserveBatch(count, reservations.begin());
+
+            for (std::size_t i = 0; i < reserved; ++i)
+            {
+                *out++ = Entity(reservations[i].id, reservations[i].version);
+            }
+
+            return reserved;
+        }
+
+        // A reserved ID has been handed out but is neither alive nor waiting in the free set, and only the
+        // exact handle that was handed out counts: recycled IDs carry their reuse version, fresh IDs the initial one
+        ASTRA_NODISCARD bool IsReserved(Entity entity) const noexcept
+        {
+            const IDType id = entity.GetID();
+            VersionType reservedVersion = NULL_VERSION;
+            if (m_idStack.FindReserved(id, reservedVersion))
+            {
+                return entity.GetVersion() == reservedVersion;
+            }
+
+            return entity.GetVersion() == INITIAL_VERSION &&
+                   id < m_idStack.GetNextID() &&
+                   m_table.GetVersion(id) == NULL_VERSION &&
+                   !m_idStack.IsFree(id);
+        }
+
+        // Bring a reserved handle to life, false when it was already materialized or released
+        bool MaterializeReserved(Entity entity) noexcept
+        {
+            if (!IsReserved(entity)) ASTRA_UNLIKELY
+            {
+                return false;
+            }
+
+            VersionType reservedVersion = NULL_VERSION;
+            if (m_idStack.FindReserved(entity.GetID(), reservedVersion))
+            {
+                m_idStack.EndReservation(entity.GetID());
+            }
+
+            m_table.SetVersion(entity.GetID(), entity.GetVersion());
+            return true;
+        }
+
+        // Return a reserved handle that will never be materialized. The ID comes back with the next
+        // version so a copy of the unused handle can never match a later entity
+        bool ReleaseReserved(Entity entity) noexcept
+        {
+            if (!IsReserved(entity)) ASTRA_UNLIKELY
+            {
+                return false;
+            }
+
+            VersionType nextVersion = entity.GetVersion() + 1;
+            if (nextVersion == NULL_VERSION) ASTRA_UNLIKELY
+            {
+                nextVersion = INITIAL_VERSION;
+            }
+
+            VersionType reservedVersion = NULL_VERSION;
+            const bool fromFreeSet = m_idStack.FindReserved(entity.GetID(), reservedVersion);
+
+            // Recycle before ending the reservation so the page it lives on is kept
+            m_idStack.Recycle(entity.GetID(), nextVersion);
+            if (fromFreeSet)
+            {
+                m_idStack.EndReservation(entity.GetID());
+            }
+            return true;
+        }
+
         ASTRA_NODISCARD bool IsValid(Entity entity) const noexcept
         {
             const IDType id = entity.GetID();
@@ -191,6 +296,19 @@ namespace Astra
             return m_table.IsAlive(id, version);
         }
 
+        // Validate a batch of handles at once. Bit i of outMask[i / 64] is set when entities[i] is valid,
+        // outMask must hold BatchMaskWords(entities.size()) words. Returns the number of valid handles
+        std::size_t IsValidBatch(std::span<const Entity> entities, std::span<uint64_t> outMask) const noexcept
+        {
+            ASTRA_ASSERT(outMask.size() >= BatchMaskWords(entities.size()), "Mask too small for batch");
+            return m_table.IsAliveBatch(entities, outMask.data());
+        }
+
+        ASTRA_NODISCARD static constexpr std::size_t BatchMaskWords(std::size_t count) noexcept
+        {
+            return (count + 63) / 64;
+        }
+
         ASTRA_NODISCARD VersionType GetVersion(IDType id) const noexcept
         {
             return m_table.GetVersion(id);
@@ -223,6 +341,11 @@ namespace Astra
             return m_idStack.RecycledCount();
         }
 
+        ASTRA_NODISCARD std::size_t SegmentCount() const noexcept
+        {
+            return m_table.SegmentCount();
+        }
+
         ASTRA_NODISCARD bool Empty() const noexcept
         {
             return m_table.AliveCount() == 0;
@@ -322,7 +445,7 @@ namespace Astra
             writer(static_cast<uint32_t>(recycledEntries.size()));
             for (const auto& entry : recycledEntries)
             {
-                writer(entry.id);
+                writer(static_cast<IDType>(entry.id));
                 writer(entry.nextVersion);
             }
             
@@ -371,7 +494,7 @@ namespace Astra
                 VersionType nextVersion;
                 reader(id);
                 reader(nextVersion);
-                recycledEntries.push_back({id, nextVersion});
+                recycledEntries.push_back({static_cast<EntityIDStack::IndexType>(id), nextVersion});
             }
             
             // Read table state
@@ -384,7 +507,7 @@ namespace Astra
             }
             
             // Recreate manager with configuration
-            manager->m_idStack = EntityIDStack();
+            manager->m_idStack.Clear();
             manager->m_table = EntityTable(manager->m_config.tableConfig);
             
             // Restore ID stack state
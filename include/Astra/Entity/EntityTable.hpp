@@ -4,10 +4,12 @@
 #include <bit>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 #include <cassert>
 
 #include "../Core/Base.hpp"
+#include "../Platform/Simd.hpp"
 #include "Entity.hpp"
 
 namespace Astra
@@ -22,6 +24,7 @@ namespace Astra
         
         static constexpr VersionType NULL_VERSION = 0;      // Marks uninitialized/destroyed slots
         static constexpr VersionType INITIAL_VERSION = 1;   // First valid version
+        static constexpr size_t BATCH_BLOCK = 64;           // Handles resolved per gather block, one mask word
         
         struct Config
         {
@@ -89,6 +92,74 @@ namespace Astra
             return GetVersion(id) == version;
         }
 
+        // Gather the stored version for each handle's ID, NULL_VERSION where no segment exists.
+        // A whole block of slot addresses is resolved and prefetched before any slot is read,
+        // so the cache misses of a scattered batch overlap instead of serializing.
+        void GetVersionBatch(std::span<const Entity> entities, VersionType* out) const noexcept
+        {
+            const VersionType* slots[BATCH_BLOCK];
+            
+            for (size_t base = 0; base < entities.size(); base += BATCH_BLOCK)
+            {
+                const size_t count = std::min(BATCH_BLOCK, entities.size() - base);
+                
+                for (size_t i = 0; i < count; ++i)
+                {
+                    slots[i] = FindSlot(entities[base + i].GetID());
+                    if (slots[i]) ASTRA_LIKELY
+                    {
+                        Simd::Ops::PrefetchT0(slots[i]);
+                    }
+                }
+                
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out[base + i] = slots[i] ? *slots[i] : NULL_VERSION;
+                }
+            }
+        }
+
+        // Set bit i of outMask[i / 64] when entities[i] is alive, clear it otherwise.
+        // Returns the number of alive handles
+        size_t IsAliveBatch(std::span<const Entity> entities, uint64_t* outMask) const noexcept
+        {
+            constexpr size_t LANES = 16 / sizeof(VersionType);
+            static_assert(BATCH_BLOCK % LANES == 0 && BATCH_BLOCK <= 64);
+            
+            alignas(16) VersionType stored[BATCH_BLOCK];
+            alignas(16) VersionType expected[BATCH_BLOCK];
+            alignas(16) const VersionType nulls[LANES] = {};
+            size_t alive = 0;
+            
+            for (size_t base = 0; base < entities.size(); base += BATCH_BLOCK)
+            {
+                const size_t count = std::min(BATCH_BLOCK, entities.size() - base);
+                
+                GetVersionBatch(entities.subspan(base, count), stored);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    expected[i] = entities[base + i].GetVersion();
+                }
+                
+                // A NULL expected version never matches, which also masks off the tail of a short block
+                std::fill(stored + count, stored + BATCH_BLOCK, NULL_VERSION);
+                std::fill(expected + count, expected + BATCH_BLOCK, NULL_VERSION);
+                
+                uint64_t word = 0;
+                for (size_t lane = 0; lane < BATCH_BLOCK; lane += LANES)
+                {
+                    const uint64_t match = Simd::Ops::MatchLanesMask(stored + lane, expected + lane);
+                    const uint64_t null = Simd::Ops::MatchLanesMask(expected + lane, nulls);
+                    word |= (match & ~null) << lane;
+                }
+                
+                outMask[base / BATCH_BLOCK] = word;
+                alive += static_cast<size_t>(Simd::Ops::PopCount(word));
+            }
+            
+            return alive;
+        }
+
         VersionType Destroy(IDType id) noexcept
         {
             auto* segment = GetSegment(id);
@@ -127,6 +198,12 @@ namespace Astra
             return m_totalAlive;
         }
 
+        // Segments currently allocated, released ones are not counted
+        ASTRA_NODISCARD size_t SegmentCount() const noexcept
+        {
+            return m_segments.size() - static_cast<size_t>(std::count(m_segments.begin(), m_segments.end(), nullptr));
+        }
+
         void Clear() noexcept
         {
             m_segments.clear();
@@ -362,6 +439,15 @@ namespace Astra
             return m_segments[idx].get();
         }
 
+        // Address of an ID's version slot, nullptr when its segment doesn't exist
+        const VersionType* FindSlot(IDType id) const noexcept
+        {
+            const Segment* segment = GetSegment(id);
+            if (!segment) ASTRA_UNLIKELY
+                return nullptr;
+            return segment->versions.get() + (id & m_config.entitiesPerSegmentMask);
+        }
+
         // Get segment for an ID (const version, no creation)
         const Segment* GetSegment(IDType id) const noexcept
         {
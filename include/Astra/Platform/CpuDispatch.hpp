@@ -0,0 +1,346 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../Core/Base.hpp"
+#include "Platform.hpp"
+
+// ARMv8 CRC32 kernel: built in when the baseline has the instructions, and on AArch64 GCC and
+// Clang compiled for them anyway so hwcaps can select it at runtime
+#if defined(__ARM_FEATURE_CRC32)
+    #define ASTRA_ARM_CRC_KERNEL 1
+    #define ASTRA_TARGET_ARM_CRC
+#elif defined(ASTRA_ARCH_ARM64) && defined(ASTRA_COMPILER_GCC)
+    #define ASTRA_ARM_CRC_KERNEL 1
+    #define ASTRA_TARGET_ARM_CRC __attribute__((target("+crc")))
+#elif defined(ASTRA_ARCH_ARM64) && defined(ASTRA_COMPILER_CLANG)
+    #define ASTRA_ARM_CRC_KERNEL 1
+    #define ASTRA_TARGET_ARM_CRC __attribute__((target("crc")))
+#endif
+
+#if defined(ASTRA_ARCH_X64)
+    #if defined(ASTRA_COMPILER_MSVC)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+#elif defined(ASTRA_ARCH_ARM64) || defined(ASTRA_ARCH_ARM32)
+    #if defined(ASTRA_ARM_CRC_KERNEL)
+        #include <arm_acle.h>
+    #endif
+    #if defined(ASTRA_PLATFORM_LINUX)
+        #include <sys/auxv.h>
+    #endif
+#endif
+
+// Compiles one function for an instruction set the build baseline may not enable, so it can be
+// selected at runtime. MSVC emits any intrinsic without it.
+#if (defined(ASTRA_COMPILER_GCC) || defined(ASTRA_COMPILER_CLANG)) && defined(ASTRA_ARCH_X64)
+    #define ASTRA_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define ASTRA_TARGET(isa)
+#endif
+
+namespace Astra
+{
+    // Instruction set extensions of the CPU the process runs on, independent of build flags
+    struct CpuFeatures
+    {
+        bool sse2 = false;
+        bool sse42 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool neon = false;
+        bool crc32 = false;  // SSE4.2 crc32 or ARMv8 CRC32 instructions
+    };
+    
+    namespace Detail
+    {
+        inline CpuFeatures DetectCpuFeatures() noexcept
+        {
+            CpuFeatures features;
+#if defined(ASTRA_ARCH_X64)
+    #if defined(ASTRA_COMPILER_MSVC)
+            int regs[4];
+            __cpuid(regs, 0);
+            const int maxLeaf = regs[0];
+            __cpuid(regs, 1);
+            const unsigned ecx1 = static_cast<unsigned>(regs[2]);
+            const unsigned edx1 = static_cast<unsigned>(regs[3]);
+            unsigned ebx7 = 0;
+            if (maxLeaf >= 7)
+            {
+                __cpuidex(regs, 7, 0);
+                ebx7 = static_cast<unsigned>(regs[1]);
+            }
+    #else
+            unsigned eax = 0, ebx = 0, ecx1 = 0, edx1 = 0, ebx7 = 0, unused = 0;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx1, &edx1))
+            {
+                return features;
+            }
+            __get_cpuid_count(7, 0, &unused, &ebx7, &unused, &unused);
+    #endif
+            features.sse2 = (edx1 & (1u << 26)) != 0;
+            features.sse42 = (ecx1 & (1u << 20)) != 0;
+            features.crc32 = features.sse42;
+            
+            // AVX state must also be enabled by the OS (OSXSAVE, then XCR0 bits 1 and 2)
+            const bool osxsave = (ecx1 & (1u << 27)) != 0;
+            if (osxsave && (ecx1 & (1u << 28)) != 0)
+            {
+    #if defined(ASTRA_COMPILER_MSVC)
+                const uint64_t xcr0 = _xgetbv(0);
+    #else
+                uint32_t xcr0Low = 0, xcr0High = 0;
+                __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+                const uint64_t xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+    #endif
+                features.avx = (xcr0 & 0x6) == 0x6;
+                features.avx2 = features.avx && (ebx7 & (1u << 5)) != 0;
+            }
+#elif defined(ASTRA_ARCH_ARM64)
+            features.neon = true;  // Mandatory on AArch64
+    #if defined(ASTRA_PLATFORM_LINUX) && defined(HWCAP_CRC32)
+            features.crc32 = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+    #elif defined(__ARM_FEATURE_CRC32)
+            features.crc32 = true;
+    #endif
+#elif defined(__ARM_FEATURE_CRC32)
+            features.crc32 = true;  // 32-bit ARM only uses it when the build enables it
+#endif
+            return features;
+        }
+    }
+    
+    // Detected once on first use
+    ASTRA_NODISCARD inline const CpuFeatures& GetCpuFeatures() noexcept
+    {
+        static const CpuFeatures s_features = Detail::DetectCpuFeatures();
+        return s_features;
+    }
+    
+    namespace Simd::Dispatch
+    {
+        // Kernels with one implementation per instruction set. Every implementation of a kernel
+        // returns identical results, so data written on one host verifies on any other.
+        //
+        // Only kernels that scan whole buffers go through the table. Per-group operations such as
+        // Swiss table matching and Bitmap tests run inside probe loops and stay inlined with
+        // compile-time selection, an indirect call per group would cost more than it saves.
+        struct KernelTable
+        {
+            // CRC-32C (Castagnoli) of a buffer, chaining: Crc32c(b, Crc32c(a)) == Crc32c(a + b)
+            uint32_t (*crc32c)(const void* data, size_t size, uint32_t crc) noexcept;
+            
+            // Index of the first full Swiss table control byte (high bit clear) in [start, count),
+            // count when there is none
+            size_t (*findFull)(const uint8_t* control, size_t count, size_t start) noexcept;
+        };
+        
+        namespace Detail
+        {
+            inline constexpr uint32_t CRC32C_POLYNOMIAL = 0x82F63B78u;  // Reflected
+            
+            // Slice-by-8 lookup tables, table k advances a byte k positions further
+            inline constexpr auto CRC32C_TABLES = []()
+            {
+                std::array<std::array<uint32_t, 256>, 8> tables{};
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t crc = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        crc = (crc >> 1) ^ ((crc & 1u) ? CRC32C_POLYNOMIAL : 0u);
+                    }
+                    tables[0][i] = crc;
+                }
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    for (size_t k = 1; k < 8; ++k)
+                    {
+                        const uint32_t prev = tables[k - 1][i];
+                        tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xFF];
+                    }
+                }
+                return tables;
+            }();
+            
+            inline uint32_t Crc32cScalar(const void* data, size_t size, uint32_t crc) noexcept
+            {
+                const auto& t = CRC32C_TABLES;
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                crc = ~crc;
+                
+                while (size >= 8)
+                {
+                    uint32_t low, high;
+                    std::memcpy(&low, bytes, 4);
+                    std::memcpy(&high, bytes + 4, 4);
+#if defined(ASTRA_BIG_ENDIAN)
+                    low = __builtin_bswap32(low);
+                    high = __builtin_bswap32(high);
+#endif
+                    low ^= crc;
+                    crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+                          t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+                    bytes += 8;
+                    size -= 8;
+                }
+                
+                while (size-- > 0)
+                {
+                    crc = (crc >> 8) ^ t[0][(crc ^ *bytes++) & 0xFF];
+                }
+                return ~crc;
+            }
+
+#if defined(ASTRA_ARCH_X64)
+            ASTRA_TARGET("sse4.2") inline uint32_t Crc32cSse42(const void* data, size_t size, uint32_t crc) noexcept
+            {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                uint64_t state = ~crc;
+                
+                while (size >= 8)
+                {
+                    uint64_t value;
+                    std::memcpy(&value, bytes, 8);
+                    state = _mm_crc32_u64(state, value);
+                    bytes += 8;
+                    size -= 8;
+                }
+                
+                uint32_t tail = static_cast<uint32_t>(state);
+                while (size-- > 0)
+                {
+                    tail = _mm_crc32_u8(tail, *bytes++);
+                }
+                return ~tail;
+            }
+#elif defined(ASTRA_ARM_CRC_KERNEL)
+            ASTRA_TARGET_ARM_CRC inline uint32_t Crc32cArm(const void* data, size_t size, uint32_t crc) noexcept
+            {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                crc = ~crc;
+                
+                while (size >= 8)
+                {
+                    uint64_t value;
+                    std::memcpy(&value, bytes, 8);
+                    crc = __crc32cd(crc, value);
+                    bytes += 8;
+                    size -= 8;
+                }
+                
+                while (size-- > 0)
+                {
+                    crc = __crc32cb(crc, *bytes++);
+                }
+                return ~crc;
+            }
+#endif
+            
+            inline constexpr uint64_t CONTROL_HIGH_BITS = 0x8080808080808080ull;
+            
+            inline size_t FindFullScalar(const uint8_t* control, size_t count, size_t start) noexcept
+            {
+                size_t i = start;
+#if !defined(ASTRA_BIG_ENDIAN)
+                for (; i + 8 <= count; i += 8)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, control + i, 8);
+                    const uint64_t full = ~word & CONTROL_HIGH_BITS;
+                    if (full != 0)
+                    {
+                        return i + (std::countr_zero(full) >> 3);
+                    }
+                }
+#endif
+                for (; i < count; ++i)
+                {
+                    if (control[i] < 0x80)
+                    {
+                        return i;
+                    }
+                }
+                return count;
+            }
+
+#if defined(ASTRA_ARCH_X64)
+            // SSE2 is part of the x86-64 baseline and needs no target attribute
+            inline size_t FindFullSse2(const uint8_t* control, size_t count, size_t start) noexcept
+            {
+                size_t i = start;
+                for (; i + 16 <= count; i += 16)
+                {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control + i));
+                    const uint32_t full = ~static_cast<uint32_t>(_mm_movemask_epi8(bytes)) & 0xFFFFu;
+                    if (full != 0)
+                    {
+                        return i + std::countr_zero(full);
+                    }
+                }
+                return FindFullScalar(control, count, i);
+            }
+            
+            ASTRA_TARGET("avx2") inline size_t FindFullAvx2(const uint8_t* control, size_t count, size_t start) noexcept
+            {
+                size_t i = start;
+                for (; i + 32 <= count; i += 32)
+                {
+                    const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(control + i));
+                    const uint32_t full = ~static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+                    if (full != 0)
+                    {
+                        return i + std::countr_zero(full);
+                    }
+                }
+                return FindFullSse2(control, count, i);
+            }
+#endif
+            
+            inline KernelTable SelectKernels(const CpuFeatures& features) noexcept
+            {
+                KernelTable table{&Crc32cScalar, &FindFullScalar};
+#if defined(ASTRA_ARCH_X64)
+                if (features.sse42)
+                {
+                    table.crc32c = &Crc32cSse42;
+                }
+                table.findFull = features.avx2 ? &FindFullAvx2 : &FindFullSse2;
+#elif defined(ASTRA_ARM_CRC_KERNEL)
+                if (features.crc32)
+                {
+                    table.crc32c = &Crc32cArm;
+                }
+#else
+                (void)features;
+#endif
+                return table;
+            }
+        }
+        
+        // Selected once from GetCpuFeatures on first use
+        ASTRA_NODISCARD inline const KernelTable& Kernels() noexcept
+        {
+            static const KernelTable s_table = Detail::SelectKernels(GetCpuFeatures());
+            return s_table;
+        }
+        
+        ASTRA_NODISCARD inline uint32_t Crc32c(const void* data, size_t size, uint32_t crc = 0) noexcept
+        {
+            return Kernels().crc32c(data, size, crc);
+        }
+        
+        ASTRA_NODISCARD inline size_t FindFull(const uint8_t* control, size_t count, size_t start = 0) noexcept
+        {
+            return Kernels().findFull(control, count, start);
+        }
+    }
+}
@@ -7,7 +7,7 @@
 
 #include "../Core/Base.hpp"
 
-#if defined(ARCH_X64) || defined(ARCH_X86)
+#if defined(ASTRA_ARCH_X64) || defined(ASTRA_ARCH_X86)
     #if defined(ASTRA_COMPILER_MSVC)
         #include <intrin.h>
         #include <nmmintrin.h>  // SSE4.2
@@ -28,6 +28,19 @@
 #include "Platform.hpp"
 #endif
 
+// Targets the lane kernels (MatchLanesMask, Capabilities::HasWidth) are compiled for. Detected here
+// rather than through Platform.hpp's ASTRA_HAS_* macros, whose x86 entries would also switch other
+// paths such as HashCombine. The NEON kernel uses vaddv, which only AArch64 has
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ASTRA_SIMD_LANES_SSE2 1
+#endif
+#if defined(__AVX2__)
+    #define ASTRA_SIMD_LANES_AVX2 1
+#endif
+#if defined(ASTRA_ARCH_ARM64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+    #define ASTRA_SIMD_LANES_NEON 1
+#endif
+
 namespace Astra
 {
 
@@ -78,7 +91,7 @@ namespace Astra
             {
                 if constexpr (std::is_same_v<Width, Width128>)
                 {
-#if defined(HAS_SSE2) || defined(HAS_NEON)
+#if defined(ASTRA_SIMD_LANES_SSE2) || defined(ASTRA_SIMD_LANES_NEON)
                     return true;
 #else
                     return false;
@@ -86,7 +99,7 @@ namespace Astra
                 }
                 else if constexpr (std::is_same_v<Width, Width256>)
                 {
-#if defined(HAS_AVX2)
+#if defined(ASTRA_SIMD_LANES_AVX2)
                     return true;
 #else
                     return false;
@@ -418,6 +431,61 @@ namespace Astra
                 }
             }
 
+            // Lane-wise equality of two 16-byte blocks, one mask bit per lane
+            // (16 lanes for 8-bit, 8 lanes for 16-bit, 4 lanes for 32-bit elements)
+            template<typename T>
+                requires std::is_unsigned_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)
+            ASTRA_FORCEINLINE uint16_t MatchLanesMask(const T* a, const T* b) noexcept
+            {
+#if defined(ASTRA_SIMD_LANES_SSE2)
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+                if constexpr (sizeof(T) == 1)
+                {
+                    return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+                }
+                else if constexpr (sizeof(T) == 2)
+                {
+                    const __m128i eq = _mm_packs_epi16(_mm_cmpeq_epi16(va, vb), _mm_setzero_si128());
+                    return static_cast<uint16_t>(_mm_movemask_epi8(eq));
+                }
+                else
+                {
+                    return static_cast<uint16_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(va, vb))));
+                }
+#elif defined(ASTRA_SIMD_LANES_NEON)
+                const uint8x8_t bit_mask = vcreate_u8(0x8040201008040201ULL);  // Lane i holds 1 << i
+                if constexpr (sizeof(T) == 1)
+                {
+                    const uint8x16_t eq = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(a)), vld1q_u8(reinterpret_cast<const uint8_t*>(b)));
+                    const uint8_t low_mask = vaddv_u8(vand_u8(vget_low_u8(eq), bit_mask));
+                    const uint8_t high_mask = vaddv_u8(vand_u8(vget_high_u8(eq), bit_mask));
+                    return (static_cast<uint16_t>(high_mask) << 8) | low_mask;
+                }
+                else if constexpr (sizeof(T) == 2)
+                {
+                    const uint8x8_t eq = vmovn_u16(vceqq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(a)), vld1q_u16(reinterpret_cast<const uint16_t*>(b))));
+                    return vaddv_u8(vand_u8(eq, bit_mask));
+                }
+                else
+                {
+                    const uint16x4_t eq16 = vmovn_u32(vceqq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(a)), vld1q_u32(reinterpret_cast<const uint32_t*>(b))));
+                    const uint8x8_t eq = vmovn_u16(vcombine_u16(eq16, vdup_n_u16(0)));
+                    return vaddv_u8(vand_u8(eq, bit_mask));
+                }
+#else
+                uint16_t mask = 0;
+                for (size_t i = 0; i < 16 / sizeof(T); ++i)
+                {
+                    if (a[i] == b[i])
+                    {
+                        mask |= static_cast<uint16_t>(1u << i);
+                    }
+                }
+                return mask;
+#endif
+            }
+
             // Population count (number of set bits)
             template<typename MaskType>
             ASTRA_FORCEINLINE int PopCount(MaskType mask) noexcept
@@ -947,5 +1015,111 @@ namespace Astra
                 }
             };
         }
+
+        // ============== Lane packs ==============
+        // Fixed-width group of 4-byte lanes (float, int32_t, uint32_t). Operations are plain
+        // loops over a constant lane count, which the compiler lowers to single SSE/AVX/NEON
+        // instructions for whatever the target enables, with a scalar fallback otherwise.
+        template<typename T, SimdWidth Width>
+        struct Pack
+        {
+            static_assert(std::is_arithmetic_v<T> && sizeof(T) == 4, "Pack lanes must be 4-byte arithmetic types");
+
+            static constexpr size_t LANES = WidthTraits<Width>::bytes / sizeof(T);
+
+            alignas(WidthTraits<Width>::bytes) T lanes[LANES];
+
+            ASTRA_NODISCARD static ASTRA_FORCEINLINE Pack Broadcast(T value) noexcept
+            {
+                Pack result;
+                for (size_t i = 0; i < LANES; ++i)
+                    result.lanes[i] = value;
+                return result;
+            }
+
+            // Load LANES contiguous values, ptr needs no particular alignment
+            ASTRA_NODISCARD static ASTRA_FORCEINLINE Pack Load(const T* ptr) noexcept
+            {
+                Pack result;
+                std::memcpy(result.lanes, ptr, sizeof(result.lanes));
+                return result;
+            }
+
+            // Load the first count lanes, the rest are zero
+            ASTRA_NODISCARD static ASTRA_FORCEINLINE Pack LoadPartial(const T* ptr, size_t count) noexcept
+            {
+                ASTRA_ASSERT(count <= LANES, "Partial count exceeds the pack width");
+                Pack result = Broadcast(T{});
+                std::memcpy(result.lanes, ptr, count * sizeof(T));
+                return result;
+            }
+
+            ASTRA_FORCEINLINE void Store(T* ptr) const noexcept
+            {
+                std::memcpy(ptr, lanes, sizeof(lanes));
+            }
+
+            // Store only the first count lanes
+            ASTRA_FORCEINLINE void StorePartial(T* ptr, size_t count) const noexcept
+            {
+                ASTRA_ASSERT(count <= LANES, "Partial count exceeds the pack width");
+                std::memcpy(ptr, lanes, count * sizeof(T));
+            }
+
+            ASTRA_NODISCARD ASTRA_FORCEINLINE T& operator[](size_t lane) noexcept { return lanes[lane]; }
+            ASTRA_NODISCARD ASTRA_FORCEINLINE T operator[](size_t lane) const noexcept { return lanes[lane]; }
+
+            ASTRA_FORCEINLINE Pack& operator+=(const Pack& other) noexcept
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    lanes[i] += other.lanes[i];
+                return *this;
+            }
+
+            ASTRA_FORCEINLINE Pack& operator-=(const Pack& other) noexcept
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    lanes[i] -= other.lanes[i];
+                return *this;
+            }
+
+            ASTRA_FORCEINLINE Pack& operator*=(const Pack& other) noexcept
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    lanes[i] *= other.lanes[i];
+                return *this;
+            }
+
+            ASTRA_FORCEINLINE Pack& operator/=(const Pack& other) noexcept
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    lanes[i] /= other.lanes[i];
+                return *this;
+            }
+
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack operator+(Pack a, const Pack& b) noexcept { return a += b; }
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack operator-(Pack a, const Pack& b) noexcept { return a -= b; }
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack operator*(Pack a, const Pack& b) noexcept { return a *= b; }
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack operator/(Pack a, const Pack& b) noexcept { return a /= b; }
+
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack Min(const Pack& a, const Pack& b) noexcept
+            {
+                Pack result;
+                for (size_t i = 0; i < LANES; ++i)
+                    result.lanes[i] = a.lanes[i] < b.lanes[i] ? a.lanes[i] : b.lanes[i];
+                return result;
+            }
+
+            ASTRA_NODISCARD friend ASTRA_FORCEINLINE Pack Max(const Pack& a, const Pack& b) noexcept
+            {
+                Pack result;
+                for (size_t i = 0; i < LANES; ++i)
+                    result.lanes[i] = a.lanes[i] > b.lanes[i] ? a.lanes[i] : b.lanes[i];
+                return result;
+            }
+        };
+
+        // Widest width with hardware support on the current target
+        using NativeWidth = std::conditional_t<Capabilities::HasWidth<Width256>(), Width256, Width128>;
     }
 }
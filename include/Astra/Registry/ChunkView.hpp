@@ -0,0 +1,203 @@
+#pragma once
+
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+#include "../Core/Base.hpp"
+#include "../Entity/Entity.hpp"
+#include "../Platform/Simd.hpp"
+#include "Query.hpp"
+
+namespace Astra
+{
+    namespace Detail
+    {
+        template<typename Tuple>
+        struct ColumnPointers;
+        
+        template<typename... Ts>
+        struct ColumnPointers<std::tuple<Ts...>>
+        {
+            using type = std::tuple<Ts*...>;
+        };
+        
+        template<typename T, typename Tuple>
+        struct TupleContains;
+        
+        template<typename T, typename... Ts>
+        struct TupleContains<T, std::tuple<Ts...>> : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+    }
+    
+    /**
+     * @brief The columns of one chunk matched by a view
+     * 
+     * Handed to View::ForEachChunk callbacks. Required components are contiguous spans of Size()
+     * elements; optional components are spans of the same length, or empty when the chunk's
+     * archetype lacks the component. Rows line up across all spans and GetEntities().
+     * 
+     * @code
+     * view.ForEachChunk([](ChunkView<Position, const Velocity> chunk) {
+     *     auto positions = chunk.Get<Position>();
+     *     auto velocities = chunk.Get<const Velocity>();
+     *     for (size_t i = 0; i < chunk.Size(); ++i) { ... }
+     * });
+     * @endcode
+     * 
+     * @tparam QueryArgs Same arguments as the view, including modifiers
+     */
+    template<typename... QueryArgs>
+    class View;
+    
+    template<typename... QueryArgs>
+    class ChunkView
+    {
+        using RequiredTypes = typename Detail::QueryClassifier<QueryArgs...>::RequiredComponents;
+        using OptionalTypes = typename Detail::QueryClassifier<QueryArgs...>::OptionalComponents;
+    
+    public:
+        using ViewType = View<QueryArgs...>;
+        using RequiredColumns = typename Detail::ColumnPointers<RequiredTypes>::type;
+        using OptionalColumns = typename Detail::ColumnPointers<OptionalTypes>::type;
+        
+        ChunkView(const Entity* entities, size_t count, RequiredColumns required, OptionalColumns optional) noexcept :
+            m_entities(entities),
+            m_count(count),
+            m_required(required),
+            m_optional(optional)
+        {}
+        
+        /**
+         * @brief Get the number of entities in the chunk
+         */
+        ASTRA_NODISCARD size_t Size() const noexcept { return m_count; }
+        
+        ASTRA_NODISCARD std::span<const Entity> GetEntities() const noexcept { return {m_entities, m_count}; }
+        
+        /**
+         * @brief Get the column of a required or optional component
+         * @return Span of Size() elements, empty for an optional component the chunk lacks
+         */
+        template<typename T>
+        ASTRA_NODISCARD std::span<T> Get() const noexcept
+        {
+            if constexpr (Detail::TupleContains<T, RequiredTypes>::value)
+            {
+                return {std::get<T*>(m_required), m_count};
+            }
+            else
+            {
+                static_assert(Detail::TupleContains<T, OptionalTypes>::value, "Component is not part of the view");
+                T* column = std::get<T*>(m_optional);
+                return column ? std::span<T>(column, m_count) : std::span<T>();
+            }
+        }
+        
+        /**
+         * @brief Check whether the chunk has a column for an optional component
+         */
+        template<typename T>
+        ASTRA_NODISCARD bool Has() const noexcept
+        {
+            if constexpr (Detail::TupleContains<T, RequiredTypes>::value)
+            {
+                return true;
+            }
+            else
+            {
+                static_assert(Detail::TupleContains<T, OptionalTypes>::value, "Component is not part of the view");
+                return std::get<T*>(m_optional) != nullptr;
+            }
+        }
+    
+    private:
+        const Entity* m_entities;
+        size_t m_count;
+        RequiredColumns m_required;
+        OptionalColumns m_optional;
+    };
+    
+    /**
+     * @brief Up to LANES consecutive components of one chunk column
+     * 
+     * Handed to View::ForEachSimd callbacks. Fields are loaded into Simd::Pack lanes and stored
+     * back; full runs copy a constant LANES elements, which the compiler vectorizes, and the last
+     * run of a chunk is masked to Count() lanes. For an optional component the archetype lacks,
+     * the view is empty and must not be loaded from.
+     * 
+     * @code
+     * view.ForEachSimd([](std::span<const Entity>, LaneView<Position> pos, LaneView<Velocity> vel) {
+     *     pos.Store(&Position::x, pos.Load(&Position::x) + vel.Load(&Velocity::dx));
+     * });
+     * @endcode
+     */
+    template<typename T, Simd::SimdWidth Width = Simd::NativeWidth>
+    class LaneView
+    {
+    public:
+        static constexpr size_t LANES = Simd::WidthTraits<Width>::bytes / 4;
+        
+        LaneView(T* base, size_t count) noexcept :
+            m_base(base),
+            m_count(count)
+        {}
+        
+        /**
+         * @brief Get the number of active lanes, LANES except at the end of a chunk
+         */
+        ASTRA_NODISCARD size_t Count() const noexcept { return m_count; }
+        ASTRA_NODISCARD bool IsFull() const noexcept { return m_count == LANES; }
+        ASTRA_NODISCARD bool IsValid() const noexcept { return m_base != nullptr; }
+        
+        ASTRA_NODISCARD T* Data() const noexcept { return m_base; }
+        ASTRA_NODISCARD T& operator[](size_t lane) const noexcept { return m_base[lane]; }
+        
+        /**
+         * @brief Gather one field of each active component into a pack, inactive lanes are zero
+         */
+        template<typename F, typename C>
+        ASTRA_NODISCARD ASTRA_FORCEINLINE Simd::Pack<F, Width> Load(F C::* field) const noexcept
+        {
+            static_assert(std::is_same_v<C, std::remove_const_t<T>>, "Field does not belong to the component");
+            
+            Simd::Pack<F, Width> pack;
+            if (IsFull()) ASTRA_LIKELY
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    pack.lanes[i] = m_base[i].*field;
+            }
+            else
+            {
+                pack = Simd::Pack<F, Width>::Broadcast(F{});
+                for (size_t i = 0; i < m_count; ++i)
+                    pack.lanes[i] = m_base[i].*field;
+            }
+            return pack;
+        }
+        
+        /**
+         * @brief Scatter the active lanes of a pack into one field of each component
+         */
+        template<typename F, typename C>
+        ASTRA_FORCEINLINE void Store(F C::* field, const Simd::Pack<F, Width>& pack) const noexcept
+        {
+            static_assert(!std::is_const_v<T>, "Cannot store into a const component");
+            static_assert(std::is_same_v<C, T>, "Field does not belong to the component");
+            
+            if (IsFull()) ASTRA_LIKELY
+            {
+                for (size_t i = 0; i < LANES; ++i)
+                    m_base[i].*field = pack.lanes[i];
+            }
+            else
+            {
+                for (size_t i = 0; i < m_count; ++i)
+                    m_base[i].*field = pack.lanes[i];
+            }
+        }
+    
+    private:
+        T* m_base;
+        size_t m_count;
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <memory>
+
+#include "../Archetype/Archetype.hpp"
+#include "../Archetype/ArchetypeManager.hpp"
+#include "../Component/Component.hpp"
+#include "../Core/Base.hpp"
+#include "../Entity/Entity.hpp"
+
+namespace Astra
+{
+    /**
+     * @brief Handle to one entity that caches where its components live
+     * 
+     * Remembers the entity's archetype, chunk and row along with the structural change counter
+     * and the archetype's layout version. While neither has moved, Get is a mask test and a
+     * pointer offset; otherwise the location is looked up again. Meant for entities a system
+     * touches every frame, such as a camera or the player.
+     * 
+     * Like views, a ref keeps reading the storage it was created from, so refs made before
+     * Registry::Clear or Load must be recreated. Get updates the cache and is not thread safe.
+     */
+    class EntityRef
+    {
+    public:
+        EntityRef() = default;
+        
+        EntityRef(std::shared_ptr<ArchetypeManager> manager, Entity entity) :
+            m_manager(std::move(manager)),
+            m_entity(entity)
+        {}
+        
+        ASTRA_NODISCARD Entity GetEntity() const noexcept { return m_entity; }
+        
+        /**
+         * @brief Get a component of the referenced entity
+         * @return Component pointer, or nullptr if the entity is gone or lacks T
+         */
+        template<Component T>
+        ASTRA_NODISCARD T* Get()
+        {
+            if (!IsCurrent()) ASTRA_UNLIKELY
+            {
+                if (!Resolve())
+                {
+                    return nullptr;
+                }
+            }
+            
+            if (!m_archetype->HasComponent<T>())
+            {
+                return nullptr;
+            }
+            return m_chunk->GetComponent<T>(m_row);
+        }
+        
+        /**
+         * @brief Check whether the referenced entity still exists
+         */
+        ASTRA_NODISCARD bool IsAlive()
+        {
+            return IsCurrent() || Resolve();
+        }
+    
+    private:
+        ASTRA_FORCEINLINE bool IsCurrent() const noexcept
+        {
+            // The counter also moves when archetypes are destroyed, so it is checked before the
+            // cached archetype is touched
+            return m_archetype &&
+                m_manager->GetStructuralChangeCounter() == m_structuralCounter &&
+                m_archetype->GetLayoutVersion() == m_layoutVersion;
+        }
+        
+        bool Resolve()
+        {
+            m_archetype = nullptr;
+            if (!m_manager)
+            {
+                return false;
+            }
+            
+            m_structuralCounter = m_manager->GetStructuralChangeCounter();
+            auto [archetype, location] = m_manager->GetEntityLocation(m_entity);
+            if (!archetype)
+            {
+                return false;
+            }
+            
+            m_archetype = archetype;
+            m_chunk = archetype->GetChunks()[location.GetChunkIndex()].get();
+            m_row = location.GetEntityIndex();
+            m_layoutVersion = archetype->GetLayoutVersion();
+            return true;
+        }
+        
+        std::shared_ptr<ArchetypeManager> m_manager;
+        Entity m_entity;
+        Archetype* m_archetype = nullptr;  // Null until resolved, or while the entity is gone
+        ArchetypeChunk* m_chunk = nullptr;
+        size_t m_row = 0;
+        uint32_t m_structuralCounter = 0;
+        uint32_t m_layoutVersion = 0;
+    };
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "../Archetype/ArchetypeManager.hpp"
+#include "../Component/Component.hpp"
+#include "../Core/Base.hpp"
+#include "../Core/JobSystem.hpp"
+#include "../Entity/Entity.hpp"
+#include "RelationshipGraph.hpp"
+
+namespace Astra
+{
+    /**
+     * @brief Parent-first iteration over the entity hierarchy
+     * 
+     * Walks the depth levels of the RelationshipGraph, so every parent is visited before any of its
+     * children, and hands the callback the entity's components along with its parent's. Members
+     * missing one of the components are skipped; their children still run, with null parent
+     * components.
+     * 
+     * Each level's component pointers are gathered in one prefetched batch and kept until the next
+     * level has run, so a parent's components are read from the level above instead of being looked
+     * up again. The callback must not add or remove components or destroy entities.
+     * 
+     * Typical use is transform propagation:
+     * @code
+     * registry.GetHierarchyView<Transform>().ParallelForEach(
+     *     [](Entity, Transform& local, const Transform* parent) { ... });
+     * @endcode
+     * 
+     * @tparam Components Components fetched for each member and its parent
+     */
+    template<Component... Components>
+    class HierarchyView
+    {
+        static_assert(sizeof...(Components) > 0, "HierarchyView needs at least one component");
+        
+        static constexpr size_t MIN_ENTITIES_PER_TASK = 1024;  // Smaller levels run on the calling thread
+    
+    public:
+        HierarchyView(std::shared_ptr<ArchetypeManager> manager, RelationshipGraph* graph, std::shared_ptr<JobSystem> jobSystem = nullptr) :
+            m_manager(std::move(manager)),
+            m_graph(graph),
+            m_jobSystem(std::move(jobSystem))
+        {}
+        
+        /**
+         * @brief Visit hierarchy members parent-first
+         * @param func Called as func(Entity, Components&..., const Components*... parentComponents)
+         */
+        template<typename Func>
+        void ForEach(Func&& func)
+        {
+            const auto& levels = m_graph->GetLevels();
+            for (size_t depth = 0; depth < levels.size(); ++depth)
+            {
+                BeginLevel(levels[depth].size());
+                ProcessRange(levels[depth], 0, levels[depth].size(), depth, func);
+            }
+        }
+        
+        /**
+         * @brief Visit hierarchy members parent-first, splitting each level across threads
+         * @param func Called as func(Entity, Components&..., const Components*... parentComponents)
+         * 
+         * Levels run one after another, so parent components are final by the time a child reads
+         * them. Entities within a level run concurrently and must only write their own components.
+         * Runs on the registry's JobSystem; without one attached it is the same as ForEach.
+         */
+        template<typename Func>
+        void ParallelForEach(Func&& func)
+        {
+            if (!m_jobSystem)
+            {
+                ForEach(func);
+                return;
+            }
+            
+            const size_t threadCount = m_jobSystem->GetWorkerCount() + 1;
+            const auto& levels = m_graph->GetLevels();
+            for (size_t depth = 0; depth < levels.size(); ++depth)
+            {
+                const auto& level = levels[depth];
+                BeginLevel(level.size());
+                
+                const size_t numWorkers = std::min(threadCount, level.size() / MIN_ENTITIES_PER_TASK);
+                if (numWorkers < 2)
+                {
+                    ProcessRange(level, 0, level.size(), depth, func);
+                    continue;
+                }
+                
+                // Workers write disjoint ranges of the level's pointer columns
+                const size_t perWorker = (level.size() + numWorkers - 1) / numWorkers;
+                m_jobSystem->ParallelFor(numWorkers, [this, &func, &level, depth, perWorker](size_t t)
+                {
+                    const size_t begin = std::min(t * perWorker, level.size());
+                    ProcessRange(level, begin, std::min(perWorker, level.size() - begin), depth, func);
+                });
+            }
+        }
+        
+        /**
+         * @brief Get the number of hierarchy levels, roots are level 0
+         */
+        ASTRA_NODISCARD size_t GetLevelCount()
+        {
+            return m_graph->GetLevels().size();
+        }
+    
+    private:
+        // Pointers of one level, a column per component indexed like the level's entities
+        using Columns = std::tuple<std::vector<Components*>...>;
+        
+        // The level just visited becomes the parent level
+        void BeginLevel(size_t size)
+        {
+            std::swap(m_parents, m_current);
+            (std::get<std::vector<Components*>>(m_current).resize(size), ...);
+        }
+        
+        template<typename Func>
+        void ProcessRange(const std::vector<Entity>& level, size_t begin, size_t count, size_t depth, Func& func)
+        {
+            m_manager->GetComponents<Components...>(std::span<const Entity>(level.data() + begin, count),
+                std::span<Components*>(std::get<std::vector<Components*>>(m_current).data() + begin, count)...);
+            
+            for (size_t i = begin; i < begin + count; ++i)
+            {
+                if (!(std::get<std::vector<Components*>>(m_current)[i] && ...))
+                    continue;
+                
+                const Entity entity = level[i];
+                if (depth > 0)
+                {
+                    const size_t parentSlot = m_graph->GetParentLevelSlot(entity);
+                    func(entity, *std::get<std::vector<Components*>>(m_current)[i]...,
+                        static_cast<const Components*>(std::get<std::vector<Components*>>(m_parents)[parentSlot])...);
+                }
+                else
+                {
+                    func(entity, *std::get<std::vector<Components*>>(m_current)[i]..., static_cast<const Components*>(nullptr)...);
+                }
+            }
+        }
+        
+        std::shared_ptr<ArchetypeManager> m_manager;
+        RelationshipGraph* m_graph;
+        std::shared_ptr<JobSystem> m_jobSystem;
+        Columns m_current;  // Pointers of the level being visited
+        Columns m_parents;  // Pointers of the level above it
+    };
+}
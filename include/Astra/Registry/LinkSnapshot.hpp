@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "../Core/Base.hpp"
+#include "../Core/JobSystem.hpp"
+#include "../Entity/Entity.hpp"
+
+namespace Astra
+{
+    /**
+     * @brief Compressed sparse row copy of the link graph for whole-graph passes
+     * 
+     * Linked entities get dense vertex indices in ascending ID order, and each vertex's neighbors
+     * are a contiguous run of indices, so algorithms run on plain arrays instead of per-entity
+     * lookups. Built by RelationshipGraph::BuildLinkSnapshot.
+     */
+    class LinkSnapshot
+    {
+    public:
+        static constexpr uint32_t INVALID_VERTEX = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t UNREACHED = std::numeric_limits<uint32_t>::max();
+        
+        /**
+         * @brief Get the number of vertices, i.e. entities with at least one link
+         */
+        ASTRA_NODISCARD size_t VertexCount() const noexcept { return m_vertices.size(); }
+        
+        /**
+         * @brief Get the number of directed edges, twice the number of links
+         */
+        ASTRA_NODISCARD size_t EdgeCount() const noexcept { return m_neighbors.size(); }
+        
+        ASTRA_NODISCARD Entity GetEntity(uint32_t vertex) const noexcept { return m_vertices[vertex]; }
+        ASTRA_NODISCARD std::span<const Entity> GetEntities() const noexcept { return m_vertices; }
+        
+        /**
+         * @brief Get the dense indices of the vertices linked to vertex
+         */
+        ASTRA_NODISCARD std::span<const uint32_t> GetNeighbors(uint32_t vertex) const noexcept
+        {
+            return {m_neighbors.data() + m_offsets[vertex], m_offsets[vertex + 1] - m_offsets[vertex]};
+        }
+        
+        /**
+         * @brief Find the vertex of an entity
+         * @return Dense index, or INVALID_VERTEX if the entity has no links
+         */
+        ASTRA_NODISCARD uint32_t GetVertex(Entity entity) const noexcept
+        {
+            auto it = std::lower_bound(m_vertices.begin(), m_vertices.end(), entity,
+                [](Entity a, Entity b) { return a.GetID() < b.GetID(); });
+            if (it == m_vertices.end() || *it != entity)
+            {
+                return INVALID_VERTEX;
+            }
+            return static_cast<uint32_t>(it - m_vertices.begin());
+        }
+        
+        /**
+         * @brief Label connected components with union-find
+         * @param outComponents Receives a component label per vertex, labels are dense from 0
+         * @return Number of components
+         */
+        size_t ConnectedComponents(std::vector<uint32_t>& outComponents) const
+        {
+            const uint32_t count = static_cast<uint32_t>(m_vertices.size());
+            outComponents.resize(count);
+            std::iota(outComponents.begin(), outComponents.end(), 0u);
+            
+            // Union by index with path halving, parents always point to smaller indices
+            auto find = [&](uint32_t v)
+            {
+                while (outComponents[v] != v)
+                {
+                    outComponents[v] = outComponents[outComponents[v]];
+                    v = outComponents[v];
+                }
+                return v;
+            };
+            
+            for (uint32_t v = 0; v < count; ++v)
+            {
+                for (uint32_t u : GetNeighbors(v))
+                {
+                    if (u < v)
+                    {
+                        uint32_t rootV = find(v);
+                        uint32_t rootU = find(u);
+                        if (rootV != rootU)
+                        {
+                            outComponents[std::max(rootV, rootU)] = std::min(rootV, rootU);
+                        }
+                    }
+                }
+            }
+            
+            // Parents precede their members, so by the time v is reached its parent already holds
+            // the label of their shared root
+            size_t components = 0;
+            for (uint32_t v = 0; v < count; ++v)
+            {
+                const uint32_t parent = outComponents[v];
+                outComponents[v] = parent == v ? static_cast<uint32_t>(components++) : outComponents[parent];
+            }
+            return components;
+        }
+        
+        /**
+         * @brief Breadth-first distances from a set of source vertices
+         * @param sources Start vertices, distance 0
+         * @param outDistances Receives the hop count per vertex, UNREACHED if not reachable
+         * @param jobSystem Pool to split large frontiers over, e.g. Registry::GetJobSystem(); null runs on the calling thread
+         * 
+         * Runs level-synchronously; large frontiers are split across the pool's workers, which claim
+         * vertices with a compare-exchange, so each vertex is expanded exactly once.
+         */
+        void BreadthFirst(std::span<const uint32_t> sources, std::vector<uint32_t>& outDistances, JobSystem* jobSystem = nullptr) const
+        {
+            outDistances.assign(m_vertices.size(), UNREACHED);
+            
+            std::vector<uint32_t> frontier;
+            frontier.reserve(sources.size());
+            for (uint32_t source : sources)
+            {
+                ASTRA_ASSERT(source < m_vertices.size(), "Invalid source vertex");
+                if (outDistances[source] == UNREACHED)
+                {
+                    outDistances[source] = 0;
+                    frontier.push_back(source);
+                }
+            }
+            
+            const size_t threadCount = jobSystem ? jobSystem->GetWorkerCount() + 1 : 1;
+            std::vector<uint32_t> next;
+            std::vector<std::vector<uint32_t>> workerNext;
+            
+            for (uint32_t depth = 1; !frontier.empty(); ++depth)
+            {
+                next.clear();
+                
+                const size_t numWorkers = std::min(threadCount, frontier.size() / MIN_VERTICES_PER_TASK);
+                if (numWorkers < 2)
+                {
+                    for (uint32_t v : frontier)
+                    {
+                        for (uint32_t u : GetNeighbors(v))
+                        {
+                            if (outDistances[u] == UNREACHED)
+                            {
+                                outDistances[u] = depth;
+                                next.push_back(u);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    workerNext.resize(numWorkers);
+                    
+                    const size_t perWorker = (frontier.size() + numWorkers - 1) / numWorkers;
+                    jobSystem->ParallelFor(numWorkers, [this, &frontier, &outDistances, &workerNext, perWorker, depth](size_t t)
+                    {
+                        const size_t begin = std::min(t * perWorker, frontier.size());
+                        const size_t end = std::min(begin + perWorker, frontier.size());
+                        auto& local = workerNext[t];
+                        local.clear();
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            for (uint32_t u : GetNeighbors(frontier[i]))
+                            {
+                                std::atomic_ref<uint32_t> distance(outDistances[u]);
+                                uint32_t expected = UNREACHED;
+                                if (distance.load(std::memory_order_relaxed) == UNREACHED &&
+                                    distance.compare_exchange_strong(expected, depth, std::memory_order_relaxed))
+                                {
+                                    local.push_back(u);
+                                }
+                            }
+                        }
+                    });
+                    
+                    // Which worker claims a shared neighbor depends on timing, so the order of the next
+                    // frontier varies between runs; the vertices in it and their distances do not
+                    for (size_t t = 0; t < numWorkers; ++t)
+                    {
+                        next.insert(next.end(), workerNext[t].begin(), workerNext[t].end());
+                    }
+                }
+                
+                frontier.swap(next);
+            }
+        }
+    
+    private:
+        friend class RelationshipGraph;
+        
+        static constexpr size_t MIN_VERTICES_PER_TASK = 2048;  // Smaller frontiers expand on the calling thread
+        
+        void Clear()
+        {
+            m_vertices.clear();
+            m_offsets.clear();
+            m_neighbors.clear();
+        }
+        
+        std::vector<Entity> m_vertices;     // Vertex index -> entity
+        std::vector<uint32_t> m_offsets;    // Neighbor run of vertex v is [m_offsets[v], m_offsets[v + 1])
+        std::vector<uint32_t> m_neighbors;
+    };
+}
@@ -11,9 +11,11 @@
 #include "../Archetype/Archetype.hpp"
 #include "../Archetype/ArchetypeManager.hpp"
 #include "../Component/Component.hpp"
+#include "../Container/FlatSet.hpp"
 #include "../Container/SmallVector.hpp"
 #include "../Component/ComponentRegistry.hpp"
 #include "../Core/Base.hpp"
+#include "../Core/JobSystem.hpp"
 #include "../Core/Result.hpp"
 #include "../Core/Signal.hpp"
 #include "../Core/TypeID.hpp"
@@ -22,9 +24,12 @@
 #include "../Serialization/BinaryReader.hpp"
 #include "../Serialization/BinaryWriter.hpp"
 #include "../Serialization/SerializationError.hpp"
+#include "EntityRef.hpp"
+#include "HierarchyView.hpp"
 #include "Query.hpp"
 #include "Relations.hpp"
 #include "RelationshipGraph.hpp"
+#include "ResourceStorage.hpp"
 #include "View.hpp"
 
 namespace Astra
@@ -36,11 +41,17 @@ namespace Astra
         {
             EntityManager::Config entityManagerConfig;
             ArchetypeChunkPool::Config chunkPoolConfig;
+            
+            // Store parent links as (ChildOf, parent) archetype pairs as well, so the children of a
+            // parent are packed into shared chunks. Off by default since every distinct parent then
+            // gets its own archetype.
+            bool childOfPairs = false;
         };
         
         explicit Registry(const Config& config = {}) :
             m_entityManager(std::make_shared<EntityManager>(config.entityManagerConfig)),
-            m_archetypeManager(std::make_shared<ArchetypeManager>(config.chunkPoolConfig))
+            m_archetypeManager(std::make_shared<ArchetypeManager>(config.chunkPoolConfig)),
+            m_childOfPairs(config.childOfPairs)
         {}
         
         Registry(const EntityManager::Config& entityConfig, const ArchetypeChunkPool::Config& chunkConfig) :
@@ -50,12 +61,14 @@ namespace Astra
         
         Registry(std::shared_ptr<ComponentRegistry> componentRegistry, const Config& config = {}) :
             m_entityManager(std::make_shared<EntityManager>(config.entityManagerConfig)),
-            m_archetypeManager(std::make_shared<ArchetypeManager>(componentRegistry, config.chunkPoolConfig))
+            m_archetypeManager(std::make_shared<ArchetypeManager>(componentRegistry, config.chunkPoolConfig)),
+            m_childOfPairs(config.childOfPairs)
         {}
         
         explicit Registry(const Registry& other, const Config& config = {}) :
             m_entityManager(std::make_shared<EntityManager>(config.entityManagerConfig)),
-            m_archetypeManager(std::make_shared<ArchetypeManager>(other.GetComponentRegistry(), config.chunkPoolConfig))
+            m_archetypeManager(std::make_shared<ArchetypeManager>(other.GetComponentRegistry(), config.chunkPoolConfig)),
+            m_childOfPairs(config.childOfPairs)
         {}
         
         template<Component... Components>
@@ -178,6 +191,10 @@ namespace Astra
             m_signalManager.Emit<Events::EntityDestroyed>(entity);
             
             m_archetypeManager->RemoveEntity(entity);
+            if (m_childOfPairs)
+            {
+                m_archetypeManager->ClearPairTarget(entity);
+            }
             m_relationshipGraph.OnEntityDestroyed(entity);
             m_entityManager->Destroy(entity);
         }
@@ -187,22 +204,32 @@ namespace Astra
             if (entities.empty())
                 return;
             
-            std::vector<Entity> validEntities;
+            // Validate the whole batch with gathered version lookups
+            SmallVector<uint64_t, 16> validMask;
+            validMask.resize(EntityManager::BatchMaskWords(entities.size()));
+            const size_t validCount = m_entityManager->IsValidBatch(entities, std::span<uint64_t>(validMask.data(), validMask.size()));
             
-            size_t reserveSize = std::min(entities.size(), size_t(10000));
-            validEntities.reserve(reserveSize);
+            if (validCount == 0)
+                return;
             
-            for (Entity entity : entities)
+            std::vector<Entity> validEntities;
+            validEntities.reserve(validCount);
+            
+            // Both copies of a duplicate handle pass validation, keep the first so it is removed once
+            // and signals, cleanup and recycling still follow input order
+            FlatSet<Entity> seen(validCount);
+            for (size_t word = 0; word < validMask.size(); ++word)
             {
-                if (m_entityManager->IsValid(entity))
+                for (uint64_t bits = validMask[word]; bits != 0; bits &= bits - 1)
                 {
-                    validEntities.push_back(entity);
+                    const Entity entity = entities[word * 64 + Simd::Ops::CountTrailingZeros(bits)];
+                    if (seen.Insert(entity).second) ASTRA_LIKELY
+                    {
+                        validEntities.push_back(entity);
+                    }
                 }
             }
             
-            if (validEntities.empty())
-                return;
-
             if (m_signalManager.IsSignalEnabled(Signal::EntityDestroyed))
             {
                 for (Entity entity : validEntities)
@@ -215,13 +242,52 @@ namespace Astra
             
             for (Entity entity : validEntities)
             {
+                if (m_childOfPairs)
+                {
+                    m_archetypeManager->ClearPairTarget(entity);
+                }
                 m_relationshipGraph.OnEntityDestroyed(entity);
             }
             
-            for (Entity entity : validEntities)
-            {
-                m_entityManager->Destroy(entity);
-            }
+            m_entityManager->DestroyBatch(validEntities.begin(), validEntities.end());
+        }
+
+        /**
+         * Reserve entity handles that are materialized later by CreateReservedEntity
+         * Safe to call from many threads at once, but not concurrently with structural changes.
+         * Free IDs are handed out first under a lock taken once per call, fresh IDs without one,
+         * so reserve in blocks as CommandBuffer does
+         * @param outEntities Receives the reserved handles
+         * @return Number of handles reserved, less than requested only when the ID space is exhausted
+         */
+        size_t ReserveEntities(std::span<Entity> outEntities) noexcept
+        {
+            return m_entityManager->ReserveEntities(outEntities.size(), outEntities.begin());
+        }
+
+        /**
+         * Bring a reserved handle to life as an empty entity
+         * @param entity Handle returned by ReserveEntities
+         * @return False if the handle was already materialized or released
+         */
+        bool CreateReservedEntity(Entity entity)
+        {
+            if (!m_entityManager->MaterializeReserved(entity))
+                return false;
+
+            m_archetypeManager->AddEntity(entity);
+            m_signalManager.Emit<Events::EntityCreated>(entity);
+            return true;
+        }
+
+        /**
+         * Give back a reserved handle that will never be materialized
+         * @param entity Handle returned by ReserveEntities
+         * @return False if the handle was already materialized or released
+         */
+        bool ReleaseReservedEntity(Entity entity) noexcept
+        {
+            return m_entityManager->ReleaseReserved(entity);
         }
 
         ASTRA_NODISCARD bool IsValid(Entity entity) const noexcept
@@ -370,6 +436,40 @@ namespace Astra
             return m_archetypeManager->GetComponent<T>(entity);
         }
         
+        /**
+         * Get a handle that caches the entity's storage location
+         * Cheaper than GetComponent for entities accessed repeatedly, see EntityRef
+         */
+        ASTRA_NODISCARD EntityRef GetEntityRef(Entity entity) const
+        {
+            return EntityRef(m_archetypeManager, entity);
+        }
+        
+        /**
+         * Gather components for many entities at once
+         * Lookups are pipelined with prefetching, which hides most of the latency of scattered
+         * entities compared to calling GetComponent in a loop.
+         * 
+         * @param entities Entities to look up
+         * @param outComponents One span per component, receiving a pointer per entity or nullptr
+         */
+        template<Component... Ts>
+        void GetComponents(std::span<const Entity> entities, std::span<Ts*>... outComponents)
+        {
+            m_archetypeManager->GetComponents<Ts...>(entities, outComponents...);
+        }
+        
+        /**
+         * Call func(entity, Ts&...) for each listed entity that has all of Ts
+         * Uses the same pipelined lookups as GetComponents. The callback must not add or remove
+         * components or destroy entities.
+         */
+        template<Component... Ts, typename Func>
+        void ForEachEntity(std::span<const Entity> entities, Func&& func)
+        {
+            m_archetypeManager->ForEachEntity<Ts...>(entities, std::forward<Func>(func));
+        }
+        
         template<Component T>
         ASTRA_NODISCARD bool HasComponent(Entity entity) const
         {
@@ -377,11 +477,66 @@ namespace Astra
                 return false;
             return m_archetypeManager->HasComponent<T>(entity);
         }
+        
+        // ====================== Resource API ======================
+        
+        /**
+         * Set a singleton resource, replacing any previous value of the same type
+         * Resources live outside entity storage, use them for global state such as time or input
+         * instead of a component on a special entity.
+         * 
+         * @return Reference to the stored resource
+         */
+        template<typename T, typename... Args>
+        T& SetResource(Args&&... args)
+        {
+            return m_resources.Emplace<std::decay_t<T>>(std::forward<Args>(args)...);
+        }
+        
+        /**
+         * Get a resource
+         * @return Resource pointer, or nullptr if it was never set
+         */
+        template<typename T>
+        ASTRA_NODISCARD T* GetResource() noexcept
+        {
+            return m_resources.Get<T>();
+        }
+        
+        template<typename T>
+        ASTRA_NODISCARD const T* GetResource() const noexcept
+        {
+            return m_resources.Get<T>();
+        }
+        
+        template<typename T>
+        ASTRA_NODISCARD bool HasResource() const noexcept
+        {
+            return m_resources.Contains<T>();
+        }
+        
+        template<typename T>
+        bool RemoveResource() noexcept
+        {
+            return m_resources.Remove<T>();
+        }
 
+        /**
+         * Attach a job system that views created afterwards run their parallel iteration on
+         * Pass null to go back to short-lived threads. The pool may be shared between registries,
+         * and views keep the pool they were created with alive.
+         */
+        void SetJobSystem(std::shared_ptr<JobSystem> jobSystem) noexcept
+        {
+            m_jobSystem = std::move(jobSystem);
+        }
+        
+        ASTRA_NODISCARD JobSystem* GetJobSystem() const noexcept { return m_jobSystem.get(); }
+        
         template<ValidQueryArg... QueryArgs>
         ASTRA_NODISCARD auto CreateView()
         {
-            return View<QueryArgs...>(m_archetypeManager);
+            return View<QueryArgs...>(m_archetypeManager, m_jobSystem);
         }
         
         void Clear()
@@ -399,7 +554,7 @@ namespace Astra
             
             m_entityManager->Clear();
             
-            // Note: We don't clear signal handlers here as they may still be valid
+            // Note: We don't clear signal handlers or resources here as they may still be valid
             // for future entities. Users can manually clear handlers if needed.
         }
 
@@ -651,6 +806,18 @@ namespace Astra
             return Relations<QueryArgs...>(m_archetypeManager, m_entityManager, entity, &m_relationshipGraph);
         }
         
+        /**
+         * Get a parent-first view over the hierarchy
+         * 
+         * @tparam Components Components passed for each member and its parent
+         * @return View walking the hierarchy level by level
+         */
+        template<Component... Components>
+        ASTRA_NODISCARD HierarchyView<Components...> GetHierarchyView()
+        {
+            return HierarchyView<Components...>(m_archetypeManager, &m_relationshipGraph, m_jobSystem);
+        }
+        
         /**
          * Set the parent of an entity
          * 
@@ -663,6 +830,12 @@ namespace Astra
             {
                 m_relationshipGraph.SetParent(child, parent);
                 
+                // The graph ignores links it rejects, such as an entity parented to itself
+                if (m_childOfPairs && m_relationshipGraph.GetParent(child) == parent)
+                {
+                    m_archetypeManager->SetPairTarget<ChildOf>(child, parent);
+                }
+                
                 // Emit parent changed signal
                 m_signalManager.Emit<Events::ParentChanged>(child, parent);
             }
@@ -680,6 +853,10 @@ namespace Astra
                 // Get current parent before removal for signal
                 Entity parent = m_relationshipGraph.GetParent(child);
                 m_relationshipGraph.RemoveParent(child);
+                if (m_childOfPairs)
+                {
+                    m_archetypeManager->SetPairTarget<ChildOf>(child, Entity::Invalid());
+                }
                 
                 // Emit parent changed signal (parent is now invalid)
                 if (parent.IsValid())
@@ -837,6 +1014,7 @@ namespace Astra
             m_entityManager->Serialize(writer);
             m_archetypeManager->Serialize(writer);
             m_relationshipGraph.Serialize(writer);
+            writer(m_childOfPairs);
             
             // Finalize with checksum
             writer.FinalizeHeader();
@@ -873,6 +1051,7 @@ namespace Astra
             m_entityManager->Serialize(writer);
             m_archetypeManager->Serialize(writer);
             m_relationshipGraph.Serialize(writer);
+            writer(m_childOfPairs);
             
             // Finalize with checksum
             writer.FinalizeHeader();
@@ -948,6 +1127,32 @@ namespace Astra
         }
         
     private:
+        /**
+         * Check that all entities stored in archetype chunks are alive, one batch per chunk
+         * @return True if no chunk references a dead or unknown entity
+         */
+        bool ValidateArchetypeEntities()
+        {
+            SmallVector<uint64_t, 16> validMask;
+            
+            for (Archetype* archetype : m_archetypeManager->GetAllArchetypes())
+            {
+                for (const auto& chunk : archetype->GetChunks())
+                {
+                    std::span<const Entity> entities(chunk->GetEntities().data(), chunk->GetCount());
+                    validMask.resize(EntityManager::BatchMaskWords(entities.size()));
+                    
+                    const size_t validCount = m_entityManager->IsValidBatch(entities, std::span<uint64_t>(validMask.data(), validMask.size()));
+                    if (validCount != entities.size())
+                    {
+                        return false;
+                    }
+                }
+            }
+            
+            return true;
+        }
+        
         /**
          * Internal helper to load registry from reader
          */
@@ -980,6 +1185,12 @@ namespace Astra
                 return Result<std::unique_ptr<Registry>, SerializationError>::Err(SerializationError::CorruptedData);
             }
             
+            // Every entity stored in an archetype must be alive in the restored entity manager
+            if (!registry->ValidateArchetypeEntities())
+            {
+                return Result<std::unique_ptr<Registry>, SerializationError>::Err(SerializationError::CorruptedData);
+            }
+            
             // Deserialize RelationshipGraph
             auto graphResult = RelationshipGraph::Deserialize(reader);
             if (graphResult.IsErr())
@@ -988,6 +1199,11 @@ namespace Astra
             }
             registry->m_relationshipGraph = std::move(*graphResult.GetValue());
             
+            if (reader.GetVersion() >= 2)
+            {
+                reader(registry->m_childOfPairs);
+            }
+            
             // Verify checksum
             auto checksumResult = reader.VerifyChecksum();
             if (checksumResult.IsErr())
@@ -1002,5 +1218,8 @@ namespace Astra
         std::shared_ptr<ArchetypeManager> m_archetypeManager;
         RelationshipGraph m_relationshipGraph;
         SignalManager m_signalManager;
+        ResourceStorage m_resources;
+        std::shared_ptr<JobSystem> m_jobSystem;  // Optional, parallel views fall back to std::async without it
+        bool m_childOfPairs = false;
     };
 }
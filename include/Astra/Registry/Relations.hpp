@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../Archetype/ArchetypeManager.hpp"
 #include "../Container/FlatSet.hpp"
+#include "../Container/SmallVector.hpp"
 #include "../Core/Base.hpp"
 #include "../Entity/Entity.hpp"
 #include "../Entity/EntityManager.hpp"
@@ -26,6 +28,93 @@ namespace Astra
         DepthFirst     // Alternative - may be better for deep hierarchies
     };
     
+    /**
+     * @brief Reusable buffers for hierarchy traversal
+     * 
+     * Traversals borrow one from a per-thread pool unless the caller passes its own, so repeated
+     * traversals stop allocating once the buffers have grown. The visited set is only used while
+     * the graph may contain parent cycles, the child buffers only by filtered ForEachChild when it
+     * groups children by archetype. A scratch must not back two live traversals at once.
+     */
+    struct TraversalScratch
+    {
+        struct GroupedChild
+        {
+            Entity entity;
+            EntityLocation location;
+            uint32_t bucket;
+        };
+        
+        std::vector<std::pair<Entity, size_t>> frontier;  // Pending (entity, depth), used as queue or stack
+        FlatSet<Entity> visited;
+        std::vector<GroupedChild> children;               // Matching children in insertion order
+        std::vector<GroupedChild> grouped;                // Same children, ordered by filter cache bucket
+        std::vector<uint32_t> bucketOffsets;
+        
+        void Reset()
+        {
+            frontier.clear();
+            if (!visited.Empty())
+            {
+                visited.Clear();
+            }
+        }
+    };
+    
+    namespace Detail
+    {
+        // Exclusive loan of a scratch from the calling thread's free list, returned on destruction
+        class TraversalScratchLease
+        {
+        public:
+            TraversalScratchLease() = default;
+            TraversalScratchLease(TraversalScratchLease&&) noexcept = default;
+            TraversalScratchLease& operator=(TraversalScratchLease&& other) noexcept
+            {
+                Return();
+                m_scratch = std::move(other.m_scratch);
+                return *this;
+            }
+            
+            ~TraversalScratchLease() { Return(); }
+            
+            static TraversalScratchLease Acquire()
+            {
+                TraversalScratchLease lease;
+                auto& freeList = FreeList();
+                if (freeList.empty())
+                {
+                    lease.m_scratch = std::make_unique<TraversalScratch>();
+                }
+                else
+                {
+                    lease.m_scratch = std::move(freeList.back());
+                    freeList.pop_back();
+                }
+                return lease;
+            }
+            
+            ASTRA_NODISCARD TraversalScratch* Get() const noexcept { return m_scratch.get(); }
+            
+            void Return()
+            {
+                if (m_scratch)
+                {
+                    FreeList().push_back(std::move(m_scratch));
+                }
+            }
+            
+        private:
+            static std::vector<std::unique_ptr<TraversalScratch>>& FreeList()
+            {
+                thread_local std::vector<std::unique_ptr<TraversalScratch>> freeList;
+                return freeList;
+            }
+            
+            std::unique_ptr<TraversalScratch> m_scratch;
+        };
+    }
+    
     /**
      * @brief Query object for filtered access to entity relationships
      * 
@@ -79,44 +168,59 @@ namespace Astra
             
             HierarchyIterator() = default;
             
-            HierarchyIterator(const Relations* parent, Entity root, bool descendants)
+            HierarchyIterator(const Relations* parent, Entity root, bool descendants, TraversalScratch* scratch = nullptr)
                 : m_parent(parent)
                 , m_graph(parent->m_graph)
                 , m_descendants(descendants)
+                , m_trackVisited(parent->m_graph->HasCycles())
             {
                 if (root.IsValid())
                 {
-                    // Mark root as visited to prevent cycles
-                    m_visited.Insert(root);
+                    AttachScratch(scratch);
                     
-                    // Start traversal from root's children/parent
-                    if (descendants)
-                    {
-                        const auto& children = m_graph->GetChildren(root);
-                        for (Entity child : children)
-                        {
-                            if (m_visited.Find(child) == m_visited.end())
-                            {
-                                m_queue.push({child, 1});
-                                m_visited.Insert(child);
-                            }
-                        }
-                    }
-                    else
+                    // Mark root as visited to prevent cycles
+                    if (m_trackVisited)
                     {
-                        Entity parent = m_graph->GetParent(root);
-                        if (parent.IsValid() && m_visited.Find(parent) == m_visited.end())
-                        {
-                            m_queue.push({parent, 1});
-                            m_visited.Insert(parent);
-                        }
+                        m_scratch->visited.Insert(root);
                     }
                     
-                    // Find first valid element
+                    // Start traversal from root's children/parent, then find first valid element
+                    Expand(root, 0);
                     Advance();
                 }
             }
             
+            // Copies continue independently on a scratch of their own
+            HierarchyIterator(const HierarchyIterator& other)
+                : m_parent(other.m_parent)
+                , m_graph(other.m_graph)
+                , m_descendants(other.m_descendants)
+                , m_trackVisited(other.m_trackVisited)
+                , m_head(other.m_head)
+                , m_current(other.m_current)
+            {
+                if (other.m_scratch)
+                {
+                    AttachScratch(nullptr);
+                    *m_scratch = *other.m_scratch;
+                }
+            }
+            
+            HierarchyIterator(HierarchyIterator&& other) noexcept = default;
+            
+            HierarchyIterator& operator=(HierarchyIterator other) noexcept
+            {
+                m_parent = other.m_parent;
+                m_graph = other.m_graph;
+                m_descendants = other.m_descendants;
+                m_trackVisited = other.m_trackVisited;
+                m_lease = std::move(other.m_lease);
+                m_scratch = other.m_scratch;
+                m_head = other.m_head;
+                m_current = other.m_current;
+                return *this;
+            }
+            
             reference operator*() const { return m_current; }
             pointer operator->() const { return &m_current; }
             
@@ -149,36 +253,51 @@ namespace Astra
             }
             
         private:
-            void Advance()
+            void AttachScratch(TraversalScratch* scratch)
             {
-                // Process queue until we find a valid entity or exhaust the queue
-                while (!m_queue.empty())
+                if (!scratch)
                 {
-                    Entry candidate = m_queue.front();
-                    m_queue.pop();
-                    
-                    // Add children/parent of this candidate for future traversal
-                    if (m_descendants)
+                    m_lease = Detail::TraversalScratchLease::Acquire();
+                    scratch = m_lease.Get();
+                }
+                m_scratch = scratch;
+                m_scratch->Reset();
+            }
+            
+            // Queue the children or the parent of entity
+            void Expand(Entity entity, size_t depth)
+            {
+                auto& frontier = m_scratch->frontier;
+                if (m_descendants)
+                {
+                    for (Entity child : m_graph->GetChildren(entity))
                     {
-                        const auto& children = m_graph->GetChildren(candidate.entity);
-                        for (Entity child : children)
+                        if (!m_trackVisited || m_scratch->visited.Insert(child).second)
                         {
-                            if (m_visited.Find(child) == m_visited.end())
-                            {
-                                m_queue.push({child, candidate.depth + 1});
-                                m_visited.Insert(child);
-                            }
+                            frontier.push_back({child, depth + 1});
                         }
                     }
-                    else
+                }
+                else
+                {
+                    Entity parent = m_graph->GetParent(entity);
+                    if (parent.IsValid() && (!m_trackVisited || m_scratch->visited.Insert(parent).second))
                     {
-                        Entity parent = m_graph->GetParent(candidate.entity);
-                        if (parent.IsValid() && m_visited.Find(parent) == m_visited.end())
-                        {
-                            m_queue.push({parent, candidate.depth + 1});
-                            m_visited.Insert(parent);
-                        }
+                        frontier.push_back({parent, depth + 1});
                     }
+                }
+            }
+            
+            void Advance()
+            {
+                // Consume the frontier in order until we find a valid entity or exhaust it
+                auto& frontier = m_scratch->frontier;
+                while (m_head < frontier.size())
+                {
+                    Entry candidate{frontier[m_head].first, frontier[m_head].second};
+                    ++m_head;
+                    
+                    Expand(candidate.entity, candidate.depth);
                     
                     // Check if entity passes filter (always true if no filtering)
                     if (m_parent->PassesFilter(candidate.entity))
@@ -188,14 +307,19 @@ namespace Astra
                     }
                 }
                 
-                m_current = Entry{};  // End iterator state
+                // End iterator state, hand the scratch back right away
+                m_current = Entry{};
+                m_lease.Return();
+                m_scratch = nullptr;
             }
             
             const Relations* m_parent = nullptr;
             const RelationshipGraph* m_graph = nullptr;
             bool m_descendants = true;
-            std::queue<Entry> m_queue;
-            FlatSet<Entity> m_visited;
+            bool m_trackVisited = false;  // Only needed while the graph may contain cycles
+            Detail::TraversalScratchLease m_lease;
+            TraversalScratch* m_scratch = nullptr;
+            size_t m_head = 0;
             Entry m_current{};
         };
         
@@ -205,16 +329,17 @@ namespace Astra
         class HierarchyRange
         {
         public:
-            HierarchyRange(const Relations* parent, Entity root, bool descendants)
-                : m_parent(parent), m_root(root), m_descendants(descendants) {}
+            HierarchyRange(const Relations* parent, Entity root, bool descendants, TraversalScratch* scratch = nullptr)
+                : m_parent(parent), m_root(root), m_descendants(descendants), m_scratch(scratch) {}
             
-            HierarchyIterator begin() const { return HierarchyIterator(m_parent, m_root, m_descendants); }
+            HierarchyIterator begin() const { return HierarchyIterator(m_parent, m_root, m_descendants, m_scratch); }
             HierarchyIterator end() const { return HierarchyIterator(); }
             
         private:
             const Relations* m_parent;
             Entity m_root;
             bool m_descendants;
+            TraversalScratch* m_scratch;
         };
         
         /**
@@ -353,85 +478,123 @@ namespace Astra
         
         /**
          * @brief Get all descendants with depth info
+         * @param scratch Buffers for the traversal, borrowed from a per-thread pool if null
          */
-        HierarchyRange GetDescendants() const
+        HierarchyRange GetDescendants(TraversalScratch* scratch = nullptr) const
         {
-            return HierarchyRange(this, m_entity, true);
+            return HierarchyRange(this, m_entity, true, scratch);
         }
         
         /**
          * @brief Get all ancestors with depth info
+         * @param scratch Buffers for the traversal, borrowed from a per-thread pool if null
          */
-        HierarchyRange GetAncestors() const
+        HierarchyRange GetAncestors(TraversalScratch* scratch = nullptr) const
         {
-            return HierarchyRange(this, m_entity, false);
+            return HierarchyRange(this, m_entity, false, scratch);
         }
         
         /**
          * @brief Execute function for each child entity
+         * 
+         * When every child is stored as a (ChildOf, parent) pair the children are streamed chunk by
+         * chunk from their pair archetypes, in storage order rather than insertion order. Otherwise
+         * filtered children are grouped by archetype, keeping insertion order within each group.
+         * The callback must not add or remove components while iterating.
          */
         template<typename Func>
         void ForEachChild(Func&& func)
         {
             const auto& children = m_graph->GetChildren(m_entity);
-            for (Entity child : children)
+            if (!children.empty() && ForEachPairChild(children.size(), func))
+            {
+                return;
+            }
+            
+            if constexpr (HasFiltering)
             {
-                if (PassesFilter(child))
+                ForEachChildByArchetype(children, func);
+            }
+            else
+            {
+                for (Entity child : children)
                 {
-                    InvokeWithComponents(child, std::forward<Func>(func));
+                    func(child);
                 }
             }
         }
         
         /**
          * @brief Execute function for each descendant entity
+         * 
+         * Children failing the filter are skipped along with their subtrees.
          */
         template<typename Func>
         void ForEachDescendant(Func&& func, TraversalOrder order = TraversalOrder::BreadthFirst)
         {
-            std::queue<std::pair<Entity, size_t>> queue;
-            FlatSet<Entity> visited;
-            visited.Insert(m_entity);
+            auto lease = Detail::TraversalScratchLease::Acquire();
+            ForEachDescendant(std::forward<Func>(func), *lease.Get(), order);
+        }
+        
+        /**
+         * @brief Execute function for each descendant entity using caller-owned buffers
+         */
+        template<typename Func>
+        void ForEachDescendant(Func&& func, TraversalScratch& scratch, TraversalOrder order = TraversalOrder::BreadthFirst)
+        {
+            scratch.Reset();
+            auto& frontier = scratch.frontier;
             
-            // Initialize with children
-            const auto& children = m_graph->GetChildren(m_entity);
-            for (Entity child : children)
+            const bool trackVisited = m_graph->HasCycles();
+            if (trackVisited)
             {
-                if (visited.Insert(child).second && PassesFilter(child))
-                {
-                    if (order == TraversalOrder::BreadthFirst)
-                    {
-                        queue.push({child, 1});
-                    }
-                    else
-                    {
-                        // For DFS, process immediately
-                        InvokeWithDepth(child, 1, std::forward<Func>(func));
-                        ForEachDescendantDFS(child, 1, visited, std::forward<Func>(func));
-                    }
-                }
+                scratch.visited.Insert(m_entity);
             }
             
-            // BFS processing
+            auto admit = [&](Entity child)
+            {
+                return (!trackVisited || scratch.visited.Insert(child).second) && PassesFilter(child);
+            };
+            
             if (order == TraversalOrder::BreadthFirst)
             {
-                while (!queue.empty())
+                // Frontier consumed front to back as a queue
+                for (Entity child : m_graph->GetChildren(m_entity))
                 {
-                    auto [entity, depth] = queue.front();
-                    queue.pop();
-                    
-                    InvokeWithDepth(entity, depth, std::forward<Func>(func));
+                    if (admit(child))
+                    {
+                        frontier.push_back({child, 1});
+                    }
+                }
+                
+                for (size_t head = 0; head < frontier.size(); ++head)
+                {
+                    auto [entity, depth] = frontier[head];
+                    InvokeWithDepth(entity, depth, func);
                     
-                    const auto& entityChildren = m_graph->GetChildren(entity);
-                    for (Entity child : entityChildren)
+                    for (Entity child : m_graph->GetChildren(entity))
                     {
-                        if (visited.Insert(child).second && PassesFilter(child))
+                        if (admit(child))
                         {
-                            queue.push({child, depth + 1});
+                            frontier.push_back({child, depth + 1});
                         }
                     }
                 }
             }
+            else
+            {
+                // Frontier used as a stack, children pushed in reverse to visit them in order
+                PushChildrenReversed(m_entity, 1, frontier, admit);
+                
+                while (!frontier.empty())
+                {
+                    auto [entity, depth] = frontier.back();
+                    frontier.pop_back();
+                    
+                    InvokeWithDepth(entity, depth, func);
+                    PushChildrenReversed(entity, depth + 1, frontier, admit);
+                }
+            }
         }
         
         /**
@@ -451,18 +614,152 @@ namespace Astra
         }
         
     private:
-        // DFS helper
+        // Returns false without visiting anything unless all children live in ChildOf pair archetypes
+        template<typename Func>
+        bool ForEachPairChild(size_t childCount, Func& func)
+        {
+            auto archetypes = m_manager->GetPairArchetypes(m_entity);
+            const ComponentID childOf = TypeID<ChildOf>::Value();
+            
+            size_t pairedCount = 0;
+            for (Archetype* archetype : archetypes)
+            {
+                if (archetype->GetPairRelation() == childOf)
+                {
+                    pairedCount += archetype->GetEntityCount();
+                }
+            }
+            
+            if (pairedCount != childCount)
+            {
+                return false;
+            }
+            
+            for (Archetype* archetype : archetypes)
+            {
+                if (archetype->GetPairRelation() != childOf || archetype->GetEntityCount() == 0)
+                {
+                    continue;
+                }
+                
+                if constexpr (HasFiltering)
+                {
+                    if (!m_filterCache[FindFilterEntry(archetype)].matches)
+                    {
+                        continue;
+                    }
+                }
+                
+                ForEachInArchetype(archetype, func, RequiredTuple{});
+            }
+            
+            return true;
+        }
+        
+        template<typename Func, typename... Components>
+        static void ForEachInArchetype(Archetype* archetype, Func& func, std::tuple<Components...>)
+        {
+            archetype->ForEach<Components...>(func);
+        }
+        
+        // Buckets children by archetype, then gathers component pointers bucket by bucket
         template<typename Func>
-        void ForEachDescendantDFS(Entity current, size_t depth, 
-                                 FlatSet<Entity>& visited, Func&& func)
+        void ForEachChildByArchetype(const RelationshipGraph::ChildrenContainer& children, Func& func)
         {
-            const auto& children = m_graph->GetChildren(current);
+            using Member = TraversalScratch::GroupedChild;
+            
+            // Leased rather than local so warm calls reuse the buffers, and so a nested call from func gets its own
+            auto lease = Detail::TraversalScratchLease::Acquire();
+            auto& members = lease.Get()->children;
+            members.clear();
             for (Entity child : children)
             {
-                if (visited.Insert(child).second && PassesFilter(child))
+                auto [archetype, location] = m_manager->GetEntityLocation(child);
+                if (!archetype) ASTRA_UNLIKELY
+                {
+                    // No record to gather from, fall back to the per-entity path
+                    if (PassesFilter(child))
+                    {
+                        InvokeWithComponents(child, func);
+                    }
+                    continue;
+                }
+                
+                const uint32_t bucket = FindFilterEntry(archetype);
+                if (m_filterCache[bucket].matches)
+                {
+                    members.push_back({child, location, bucket});
+                }
+            }
+            
+            if (members.empty())
+            {
+                return;
+            }
+            
+            // Counting sort by bucket, stable so siblings keep their order within an archetype
+            auto& offsets = lease.Get()->bucketOffsets;
+            offsets.assign(m_filterCache.size() + 1, 0);
+            for (const Member& member : members)
+            {
+                ++offsets[member.bucket + 1];
+            }
+            for (size_t i = 1; i < offsets.size(); ++i)
+            {
+                offsets[i] += offsets[i - 1];
+            }
+            
+            auto& sorted = lease.Get()->grouped;
+            sorted.resize(members.size());
+            for (const Member& member : members)
+            {
+                sorted[offsets[member.bucket]++] = member;
+            }
+            
+            for (size_t begin = 0; begin < sorted.size();)
+            {
+                Archetype* archetype = m_filterCache[sorted[begin].bucket].archetype;
+                size_t end = begin;
+                while (end < sorted.size() && sorted[end].bucket == sorted[begin].bucket)
+                {
+                    ++end;
+                }
+                
+                for (size_t i = begin; i < end; ++i)
                 {
-                    InvokeWithDepth(child, depth + 1, std::forward<Func>(func));
-                    ForEachDescendantDFS(child, depth + 1, visited, std::forward<Func>(func));
+                    if (i + PREFETCH_DISTANCE < end)
+                    {
+                        PrefetchComponents(archetype, sorted[i + PREFETCH_DISTANCE].location, RequiredTuple{});
+                    }
+                    InvokeAtLocation(archetype, sorted[i].entity, sorted[i].location, func, RequiredTuple{});
+                }
+                
+                begin = end;
+            }
+        }
+        
+        template<typename... Components>
+        static void PrefetchComponents(Archetype* archetype, EntityLocation location, std::tuple<Components...>)
+        {
+            (Simd::Ops::PrefetchT0(archetype->GetComponent<Components>(location)), ...);
+        }
+        
+        template<typename Func, typename... Components>
+        static void InvokeAtLocation(Archetype* archetype, Entity entity, EntityLocation location, Func& func, std::tuple<Components...>)
+        {
+            func(entity, *archetype->GetComponent<Components>(location)...);
+        }
+        
+        // DFS helper
+        template<typename Admit>
+        void PushChildrenReversed(Entity entity, size_t depth, std::vector<std::pair<Entity, size_t>>& frontier, Admit& admit) const
+        {
+            const auto& children = m_graph->GetChildren(entity);
+            for (size_t i = children.size(); i-- > 0;)
+            {
+                if (admit(children[i]))
+                {
+                    frontier.push_back({children[i], depth});
                 }
             }
         }
@@ -522,7 +819,10 @@ namespace Astra
         }
         
         /**
-         * @brief Simplified filter check using if constexpr
+         * @brief Check an entity against the filter
+         * 
+         * The filter only depends on the archetype mask, so results are memoized per archetype and
+         * most checks reduce to the entity lookup plus a short cache scan.
          */
         ASTRA_FORCEINLINE bool PassesFilter(Entity entity) const
         {
@@ -532,108 +832,55 @@ namespace Astra
             }
             else
             {
-                // Check required components
-                if constexpr (std::tuple_size_v<RequiredTuple> > 0)
-                {
-                    if (!HasAllRequired(entity, RequiredTuple{}))
-                        return false;
-                }
-                
-                // Check excluded components
-                if constexpr (std::tuple_size_v<ExcludedTuple> > 0)
-                {
-                    if (HasAnyExcluded(entity, ExcludedTuple{}))
-                        return false;
-                }
-                
-                // Check Any groups
-                if constexpr (std::tuple_size_v<AnyGroups> > 0)
-                {
-                    if (!CheckAnyGroups(entity))
-                        return false;
-                }
-                
-                // Check OneOf groups
-                if constexpr (std::tuple_size_v<OneOfGroups> > 0)
-                {
-                    if (!CheckOneOfGroups(entity))
-                        return false;
-                }
-                
-                return true;
+                // Entities without a record have no components, a null key caches that case too
+                return m_filterCache[FindFilterEntry(m_manager->GetEntityLocation(entity).first)].matches;
             }
         }
         
-        // Simplified component checking helpers (only compiled if HasFiltering)
-        template<typename... Ts>
-        bool HasAllRequired(Entity entity, std::tuple<Ts...>) const
-        {
-            if constexpr (sizeof...(Ts) == 0)
-                return true;
-            else
-                return ((m_manager->GetComponent<Ts>(entity) != nullptr) && ...);
-        }
-        
-        template<typename... Ts>
-        bool HasAnyExcluded(Entity entity, std::tuple<Ts...>) const
-        {
-            if constexpr (sizeof...(Ts) == 0)
-                return false;
-            else
-                return ((m_manager->GetComponent<Ts>(entity) != nullptr) || ...);
-        }
-        
-        bool CheckAnyGroups(Entity entity) const
-        {
-            return CheckAnyGroupsImpl(entity, std::make_index_sequence<std::tuple_size_v<AnyGroups>>{});
-        }
-        
-        template<size_t... Is>
-        bool CheckAnyGroupsImpl(Entity entity, std::index_sequence<Is...>) const
-        {
-            return (CheckSingleAnyGroup<Is>(entity) && ...);
-        }
-        
-        template<size_t I>
-        bool CheckSingleAnyGroup(Entity entity) const
-        {
-            using Group = std::tuple_element_t<I, AnyGroups>;
-            return HasAnyInGroup(entity, Group{});
-        }
-        
-        template<typename... Ts>
-        bool HasAnyInGroup(Entity entity, std::tuple<Ts...>) const
-        {
-            return ((m_manager->GetComponent<Ts>(entity) != nullptr) || ...);
-        }
-        
-        bool CheckOneOfGroups(Entity entity) const
-        {
-            return CheckOneOfGroupsImpl(entity, std::make_index_sequence<std::tuple_size_v<OneOfGroups>>{});
-        }
-        
-        template<size_t... Is>
-        bool CheckOneOfGroupsImpl(Entity entity, std::index_sequence<Is...>) const
+        /**
+         * @brief Find or add the cached filter result for an archetype
+         * @return Index into m_filterCache
+         * 
+         * Archetypes may be destroyed and their addresses reused, so the cache is dropped whenever
+         * the structural change counter moves.
+         */
+        uint32_t FindFilterEntry(Archetype* archetype) const
         {
-            return (CheckSingleOneOfGroup<Is>(entity) && ...);
+            const uint32_t counter = m_manager->GetStructuralChangeCounter();
+            if (counter != m_filterCacheCounter) ASTRA_UNLIKELY
+            {
+                m_filterCache.clear();
+                m_filterCacheCounter = counter;
+            }
+            
+            for (uint32_t i = 0; i < m_filterCache.size(); ++i)
+            {
+                if (m_filterCache[i].archetype == archetype)
+                {
+                    return i;
+                }
+            }
+            
+            const bool matches = QueryBuilder<QueryArgs...>::Matches(archetype ? archetype->GetMask() : ComponentMask{});
+            m_filterCache.push_back({archetype, matches});
+            return static_cast<uint32_t>(m_filterCache.size() - 1);
         }
         
-        template<size_t I>
-        bool CheckSingleOneOfGroup(Entity entity) const
+        struct FilterCacheEntry
         {
-            using Group = std::tuple_element_t<I, OneOfGroups>;
-            return CountInGroup(entity, Group{}) == 1;
-        }
+            Archetype* archetype;
+            bool matches;
+        };
         
-        template<typename... Ts>
-        size_t CountInGroup(Entity entity, std::tuple<Ts...>) const
-        {
-            return ((m_manager->GetComponent<Ts>(entity) != nullptr ? 1 : 0) + ...);
-        }
+        static constexpr size_t PREFETCH_DISTANCE = 4;  // Children ahead of the current one to prefetch
         
         std::shared_ptr<ArchetypeManager> m_manager;
         std::shared_ptr<EntityManager> m_entityManager;
         Entity m_entity;
         const RelationshipGraph* m_graph;
+        
+        // Filter results per archetype, see FindFilterEntry
+        mutable SmallVector<FilterCacheEntry, 8> m_filterCache;
+        mutable uint32_t m_filterCacheCounter = 0;
     };
 }
\ No newline at end of file
@@ -1,6 +1,12 @@
 #pragma once
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "../Core/Base.hpp"
 #include "../Core/Result.hpp"
@@ -9,9 +15,19 @@
 #include "../Serialization/BinaryWriter.hpp"
 #include "../Serialization/BinaryReader.hpp"
 #include "../Serialization/SerializationError.hpp"
+#include "LinkSnapshot.hpp"
 
 namespace Astra
 {
+    /**
+     * @brief Relation tag for (ChildOf, parent) archetype pairs
+     * 
+     * With Registry::Config::childOfPairs enabled, SetParent also moves the child into an
+     * archetype keyed by its components plus this tag and the parent, so siblings share chunks.
+     * The graph below stays the source of truth for hierarchy queries.
+     */
+    struct ChildOf {};
+    
     /**
      * @brief Graph-based storage for entity relationships (parent-child hierarchies and links)
      * 
@@ -21,6 +37,9 @@ namespace Astra
      * - Bidirectional links between entities
      * 
      * All relationships are automatically cleaned up when entities are destroyed.
+     * 
+     * Storage is paged by entity ID, so every lookup is an array access. A slot is owned by
+     * one entity version at a time and is released once it holds no relationships.
      */
     class RelationshipGraph
     {
@@ -51,33 +70,74 @@ namespace Astra
             // Remove from old parent if exists
             RemoveParent(child);
             
+            EvictStale(child);
+            EvictStale(parent);
+            
             // Set new parent
-            m_parents[child] = parent;
-            m_children[parent].push_back(child);
+            auto [childPage, childIndex] = Acquire(child);
+            childPage->parents[childIndex] = parent;
+            ++m_childCount;
+            
+            auto [parentPage, parentIndex] = Acquire(parent);
+            auto& children = parentPage->children[parentIndex];
+            if (children.empty())
+            {
+                ++m_parentCount;
+            }
+            childPage->childSlots[childIndex] = static_cast<uint32_t>(children.size());
+            children.push_back(child);
+            
+            // Only a child with children of its own can close a cycle
+            if (!m_hasCycles && HasChildren(child))
+            {
+                DetectCycle(child, parent);
+            }
+            
+            UpdateLevelsOnAttach(child, parent);
         }
         
         /**
          * @brief Remove the parent of an entity
          * @param child The child entity
+         * 
+         * Constant time: the parent's last child takes the removed child's place in the list,
+         * so sibling order is not kept across removals.
          */
         void RemoveParent(Entity child)
         {
-            auto it = m_parents.find(child);
-            if (it != m_parents.end())
+            auto [childPage, childIndex] = Find(child);
+            if (!childPage || !childPage->parents[childIndex].IsValid())
+                return;
+            
+            Entity parent = childPage->parents[childIndex];
+            childPage->parents[childIndex] = Entity::Invalid();
+            --m_childCount;
+            
+            // Swap-remove from the parent's children list and patch the slot of the moved sibling
+            auto [parentPage, parentIndex] = Find(parent);
+            ASTRA_ASSERT(parentPage, "Parent slot missing for child");
+            auto& children = parentPage->children[parentIndex];
+            const uint32_t slot = childPage->childSlots[childIndex];
+            ASTRA_ASSERT(slot < children.size() && children[slot] == child, "Child slot out of sync with its parent");
+            
+            const Entity moved = children.back();
+            children[slot] = moved;
+            children.pop_back();
+            if (moved != child)
             {
-                Entity parent = it->second;
-                m_parents.erase(it);
-                
-                // Remove from parent's children list
-                auto& children = m_children[parent];
-                children.erase(std::remove(children.begin(), children.end(), child), children.end());
-                
-                // Clean up empty children container
-                if (children.empty())
-                {
-                    m_children.erase(parent);
-                }
+                auto [movedPage, movedIndex] = Find(moved);
+                movedPage->childSlots[movedIndex] = slot;
             }
+            if (children.empty())
+            {
+                --m_parentCount;
+            }
+            
+            UpdateLevelsOnDetach(child, parent);
+            
+            // Clean up slots left without relationships
+            ReleaseIfEmpty(parent);
+            ReleaseIfEmpty(child);
         }
         
         /**
@@ -87,8 +147,8 @@ namespace Astra
          */
         Entity GetParent(Entity child) const
         {
-            auto it = m_parents.find(child);
-            return (it != m_parents.end()) ? it->second : Entity::Invalid();
+            auto [page, index] = Find(child);
+            return page ? page->parents[index] : Entity::Invalid();
         }
         
         /**
@@ -98,18 +158,18 @@ namespace Astra
          */
         bool HasParent(Entity child) const
         {
-            return m_parents.find(child) != m_parents.end();
+            return GetParent(child).IsValid();
         }
         
         /**
          * @brief Get the children of an entity
          * @param parent The parent entity
-         * @return View of the children (may be empty)
+         * @return View of the children (may be empty), in attach order until a child is removed
          */
         const ChildrenContainer& GetChildren(Entity parent) const
         {
-            auto it = m_children.find(parent);
-            return (it != m_children.end()) ? it->second : s_emptyChildren;
+            auto [page, index] = Find(parent);
+            return page ? page->children[index] : s_emptyChildren;
         }
         
         /**
@@ -119,10 +179,64 @@ namespace Astra
          */
         bool HasChildren(Entity parent) const
         {
-            auto it = m_children.find(parent);
-            return it != m_children.end() && !it->second.empty();
+            return !GetChildren(parent).empty();
+        }
+        
+        /**
+         * @brief Get hierarchy members grouped by depth
+         * @return Level d holds every member with d ancestors, so parents precede their children
+         * 
+         * Members are entities with a parent or children. Attaching and detaching leaves updates the
+         * levels in place, moving a subtree rebuilds them on the next call. Entities caught in a
+         * parent cycle have no depth and are left out.
+         */
+        const std::vector<std::vector<Entity>>& GetLevels()
+        {
+            if (m_levelsDirty)
+            {
+                RebuildLevels();
+            }
+            return m_levels;
+        }
+        
+        /**
+         * @brief Get where a member's parent sits in the level above it
+         * @param child A member of GetLevels()[depth] with depth > 0
+         * @return Index of the parent in GetLevels()[depth - 1]
+         */
+        size_t GetParentLevelSlot(Entity child) const
+        {
+            ASTRA_ASSERT(!m_levelsDirty, "Levels must be current, call GetLevels first");
+            auto [page, index] = Find(child);
+            ASTRA_ASSERT(page && page->parents[index].IsValid(), "Entity has no parent");
+            auto [parentPage, parentIndex] = Find(page->parents[index]);
+            return parentPage->levelSlots[parentIndex];
+        }
+        
+        /**
+         * @brief Get a compressed sparse row copy of the links
+         * @return Snapshot owned by the graph, valid until the next call after links change
+         * 
+         * Rebuilt only when links were added or removed since the previous call.
+         */
+        const LinkSnapshot& BuildLinkSnapshot()
+        {
+            if (m_linksDirty)
+            {
+                RebuildLinkSnapshot();
+            }
+            return m_linkSnapshot;
         }
         
+        /**
+         * @brief Check whether the parent links may contain a cycle
+         * @return False only if every parent chain ends at a root
+         * 
+         * Set as soon as SetParent closes a cycle. It is conservative afterwards and is only
+         * cleared by Clear or when rebuilding the levels reaches every member.
+         */
+        bool HasCycles() const { return m_hasCycles; }
+        
         // Link relationships
         
         /**
@@ -142,18 +256,16 @@ namespace Astra
             if (!a.IsValid() || !b.IsValid() || a == b)
                 return;
             
-            // Add bidirectional link
-            auto& linksA = m_links[a];
-            if (std::find(linksA.begin(), linksA.end(), b) == linksA.end())
-            {
-                linksA.push_back(b);
-            }
+            if (AreLinked(a, b))
+                return;
             
-            auto& linksB = m_links[b];
-            if (std::find(linksB.begin(), linksB.end(), a) == linksB.end())
-            {
-                linksB.push_back(a);
-            }
+            EvictStale(a);
+            EvictStale(b);
+            
+            // Add bidirectional link
+            AddLinkTo(a, b);
+            AddLinkTo(b, a);
+            m_linksDirty = true;
         }
         
         /**
@@ -163,23 +275,14 @@ namespace Astra
          */
         void RemoveLink(Entity a, Entity b)
         {
-            auto RemoveFromLinks = [this](Entity from, Entity to)
-            {
-                auto it = m_links.find(from);
-                if (it != m_links.end())
-                {
-                    auto& links = it->second;
-                    links.erase(std::remove(links.begin(), links.end(), to), links.end());
-                    
-                    if (links.empty())
-                    {
-                        m_links.erase(it);
-                    }
-                }
-            };
+            if (!AreLinked(a, b))
+                return;
             
-            RemoveFromLinks(a, b);
-            RemoveFromLinks(b, a);
+            RemoveLinkFrom(a, b);
+            RemoveLinkFrom(b, a);
+            m_linksDirty = true;
+            ReleaseIfEmpty(a);
+            ReleaseIfEmpty(b);
         }
         
         /**
@@ -189,8 +292,8 @@ namespace Astra
          */
         const LinksContainer& GetLinks(Entity entity) const
         {
-            auto it = m_links.find(entity);
-            return (it != m_links.end()) ? it->second : s_emptyLinks;
+            auto [page, index] = Find(entity);
+            return page ? page->links[index] : s_emptyLinks;
         }
         
         /**
@@ -201,13 +304,14 @@ namespace Astra
          */
         bool AreLinked(Entity a, Entity b) const
         {
-            auto it = m_links.find(a);
-            if (it != m_links.end())
+            // Links are symmetric, so scanning the shorter list is enough
+            const auto& linksA = GetLinks(a);
+            const auto& linksB = GetLinks(b);
+            if (linksA.size() <= linksB.size())
             {
-                const auto& links = it->second;
-                return std::find(links.begin(), links.end(), b) != links.end();
+                return std::find(linksA.begin(), linksA.end(), b) != linksA.end();
             }
-            return false;
+            return std::find(linksB.begin(), linksB.end(), a) != linksB.end();
         }
         
         /**
@@ -217,8 +321,7 @@ namespace Astra
          */
         bool HasLinks(Entity entity) const
         {
-            auto it = m_links.find(entity);
-            return it != m_links.end() && !it->second.empty();
+            return !GetLinks(entity).empty();
         }
         
         // Entity cleanup
@@ -238,39 +341,43 @@ namespace Astra
             // Remove as child from parent
             RemoveParent(entity);
             
-            // Remove all children (they become orphaned)
-            auto childrenIt = m_children.find(entity);
-            if (childrenIt != m_children.end())
+            auto [page, index] = Find(entity);
+            if (!page)
+                return;
+            
+            // Take the lists out so releasing the other slots cannot touch them
+            ChildrenContainer children;
+            LinksContainer links;
+            children.swap(page->children[index]);
+            links.swap(page->links[index]);
+            
+            // Remove all children (they become orphaned roots of their subtrees)
+            if (!children.empty())
             {
-                // Clear parent references for all children
-                for (Entity child : childrenIt->second)
+                --m_parentCount;
+                m_levelsDirty = true;
+                for (Entity child : children)
                 {
-                    m_parents.erase(child);
+                    auto [childPage, childIndex] = Find(child);
+                    childPage->parents[childIndex] = Entity::Invalid();
+                    --m_childCount;
+                    ReleaseIfEmpty(child);
                 }
-                m_children.erase(childrenIt);
             }
             
-            // Remove all links
-            auto linksIt = m_links.find(entity);
-            if (linksIt != m_links.end())
+            // Remove this entity from all linked entities
+            if (!links.empty())
             {
-                // Remove this entity from all linked entities
-                for (Entity linked : linksIt->second)
+                --m_linkedCount;
+                m_linksDirty = true;
+                for (Entity linked : links)
                 {
-                    auto otherIt = m_links.find(linked);
-                    if (otherIt != m_links.end())
-                    {
-                        auto& otherLinks = otherIt->second;
-                        otherLinks.erase(std::remove(otherLinks.begin(), otherLinks.end(), entity), otherLinks.end());
-                        
-                        if (otherLinks.empty())
-                        {
-                            m_links.erase(otherIt);
-                        }
-                    }
+                    RemoveLinkFrom(linked, entity);
+                    ReleaseIfEmpty(linked);
                 }
-                m_links.erase(linksIt);
             }
+            
+            ReleaseIfEmpty(entity);
         }
         
         // Statistics
@@ -279,28 +386,34 @@ namespace Astra
          * @brief Get the total number of parent-child relationships
          * @return Number of entities that have a parent
          */
-        size_t GetParentChildCount() const { return m_parents.size(); }
+        size_t GetParentChildCount() const { return m_childCount; }
         
         /**
          * @brief Get the total number of entities with children
          * @return Number of entities that have at least one child
          */
-        size_t GetParentCount() const { return m_children.size(); }
+        size_t GetParentCount() const { return m_parentCount; }
         
         /**
          * @brief Get the total number of entities with links
          * @return Number of entities that have at least one link
          */
-        size_t GetLinkedEntityCount() const { return m_links.size(); }
+        size_t GetLinkedEntityCount() const { return m_linkedCount; }
         
         /**
          * @brief Clear all relationships
          */
         void Clear()
         {
-            m_parents.clear();
-            m_children.clear();
-            m_links.clear();
+            m_pages.clear();
+            m_levels.clear();
+            m_levelsDirty = false;
+            m_hasCycles = false;
+            m_linkSnapshot.Clear();
+            m_linksDirty = false;
+            m_childCount = 0;
+            m_parentCount = 0;
+            m_linkedCount = 0;
         }
         
         // Serialization
@@ -313,24 +426,31 @@ namespace Astra
         {
             // Write parent-child relationships
             // Write parent count
-            uint32_t parentCount = static_cast<uint32_t>(m_parents.size());
+            uint32_t parentCount = static_cast<uint32_t>(m_childCount);
             writer(parentCount);
             
             // Write each parent-child pair
-            for (const auto& [child, parent] : m_parents)
+            ForEachSlot([&](const Page& page, size_t index)
             {
-                writer(child.GetValue());
-                writer(parent.GetValue());
-            }
+                if (page.parents[index].IsValid())
+                {
+                    writer(page.entities[index].GetValue());
+                    writer(page.parents[index].GetValue());
+                }
+            });
             
             // Write children mappings
             // Note: We can reconstruct this from parents, but storing it is faster
-            uint32_t parentWithChildrenCount = static_cast<uint32_t>(m_children.size());
+            uint32_t parentWithChildrenCount = static_cast<uint32_t>(m_parentCount);
             writer(parentWithChildrenCount);
             
-            for (const auto& [parent, children] : m_children)
+            ForEachSlot([&](const Page& page, size_t index)
             {
-                writer(parent.GetValue());
+                const auto& children = page.children[index];
+                if (children.empty())
+                    return;
+                
+                writer(page.entities[index].GetValue());
                 uint32_t childCount = static_cast<uint32_t>(children.size());
                 writer(childCount);
                 
@@ -338,15 +458,19 @@ namespace Astra
                 {
                     writer(child.GetValue());
                 }
-            }
+            });
             
             // Write link relationships
-            uint32_t linkedEntityCount = static_cast<uint32_t>(m_links.size());
+            uint32_t linkedEntityCount = static_cast<uint32_t>(m_linkedCount);
             writer(linkedEntityCount);
             
-            for (const auto& [entity, links] : m_links)
+            ForEachSlot([&](const Page& page, size_t index)
             {
-                writer(entity.GetValue());
+                const auto& links = page.links[index];
+                if (links.empty())
+                    return;
+                
+                writer(page.entities[index].GetValue());
                 uint32_t linkCount = static_cast<uint32_t>(links.size());
                 writer(linkCount);
                 
@@ -354,7 +478,7 @@ namespace Astra
                 {
                     writer(linked.GetValue());
                 }
-            }
+            });
         }
         
         /**
@@ -375,8 +499,6 @@ namespace Astra
                 return Result<RelationshipGraph, SerializationError>::Err(reader.GetError());
             }
             
-            graph.m_parents.reserve(parentCount);
-            
             for (uint32_t i = 0; i < parentCount; ++i)
             {
                 Entity::IDType childValue, parentValue;
@@ -390,7 +512,13 @@ namespace Astra
                 
                 Entity child(childValue);
                 Entity parent(parentValue);
-                graph.m_parents[child] = parent;
+                graph.EvictStale(child);
+                auto [page, index] = graph.Acquire(child);
+                if (!page->parents[index].IsValid())
+                {
+                    ++graph.m_childCount;
+                }
+                page->parents[index] = parent;
             }
             
             // Read children mappings
@@ -402,8 +530,6 @@ namespace Astra
                 return Result<RelationshipGraph, SerializationError>::Err(reader.GetError());
             }
             
-            graph.m_children.reserve(parentWithChildrenCount);
-            
             for (uint32_t i = 0; i < parentWithChildrenCount; ++i)
             {
                 Entity::IDType parentValue;
@@ -418,7 +544,13 @@ namespace Astra
                 }
                 
                 Entity parent(parentValue);
-                auto& children = graph.m_children[parent];
+                graph.EvictStale(parent);
+                auto [page, index] = graph.Acquire(parent);
+                auto& children = page->children[index];
+                if (children.empty() && childCount > 0)
+                {
+                    ++graph.m_parentCount;
+                }
                 children.reserve(childCount);
                 
                 for (uint32_t j = 0; j < childCount; ++j)
@@ -431,7 +563,14 @@ namespace Astra
                         return Result<RelationshipGraph, SerializationError>::Err(reader.GetError());
                     }
                     
-                    children.push_back(Entity(childValue));
+                    // Children were read as part of the parent pairs above, keep their list position
+                    Entity child(childValue);
+                    auto [childPage, childIndex] = graph.Find(child);
+                    if (childPage)
+                    {
+                        childPage->childSlots[childIndex] = static_cast<uint32_t>(children.size());
+                    }
+                    children.push_back(child);
                 }
             }
             
@@ -444,8 +583,6 @@ namespace Astra
                 return Result<RelationshipGraph, SerializationError>::Err(reader.GetError());
             }
             
-            graph.m_links.reserve(linkedEntityCount);
-            
             for (uint32_t i = 0; i < linkedEntityCount; ++i)
             {
                 Entity::IDType entityValue;
@@ -460,7 +597,13 @@ namespace Astra
                 }
                 
                 Entity entity(entityValue);
-                auto& links = graph.m_links[entity];
+                graph.EvictStale(entity);
+                auto [page, index] = graph.Acquire(entity);
+                auto& links = page->links[index];
+                if (links.empty() && linkCount > 0)
+                {
+                    ++graph.m_linkedCount;
+                }
                 links.reserve(linkCount);
                 
                 for (uint32_t j = 0; j < linkCount; ++j)
@@ -477,16 +620,347 @@ namespace Astra
                 }
             }
             
+            // Derives the levels and whether the loaded links contain cycles
+            graph.RebuildLevels();
+            graph.m_linksDirty = true;
             return Result<RelationshipGraph, SerializationError>::Ok(std::move(graph));
         }
 
     private:
-        // Parent-child relationships
-        std::unordered_map<Entity, Entity> m_parents;                    // child -> parent
-        std::unordered_map<Entity, ChildrenContainer> m_children;       // parent -> children
+        static constexpr size_t PAGE_SHIFT = 8;
+        static constexpr size_t PAGE_SIZE = size_t(1) << PAGE_SHIFT;
+        static constexpr uint32_t NO_LEVEL = std::numeric_limits<uint32_t>::max();
         
-        // Link relationships
-        std::unordered_map<Entity, LinksContainer> m_links;             // entity -> linked entities
+        // Slots for PAGE_SIZE consecutive IDs, split by field so parent walks stay compact
+        struct Page
+        {
+            std::array<Entity, PAGE_SIZE> entities;     // Slot owner, invalid while unused
+            std::array<Entity, PAGE_SIZE> parents;
+            std::array<ChildrenContainer, PAGE_SIZE> children;
+            std::array<uint32_t, PAGE_SIZE> childSlots; // Index in the parent's children list, valid with a parent
+            std::array<LinksContainer, PAGE_SIZE> links;
+            std::array<uint32_t, PAGE_SIZE> depths;
+            std::array<uint32_t, PAGE_SIZE> levelSlots; // Index in m_levels[depth], NO_LEVEL if not leveled
+            size_t liveCount = 0;
+            
+            Page()
+            {
+                depths.fill(0);
+                childSlots.fill(0);
+                levelSlots.fill(NO_LEVEL);
+            }
+        };
+        
+        // Slot owned by entity, page is null if the entity has no relationships
+        std::pair<Page*, size_t> Find(Entity entity) const
+        {
+            const size_t id = static_cast<size_t>(entity.GetID());
+            const size_t pageIdx = id >> PAGE_SHIFT;
+            if (pageIdx >= m_pages.size() || !m_pages[pageIdx])
+            {
+                return {nullptr, 0};
+            }
+            
+            Page* page = m_pages[pageIdx].get();
+            const size_t index = id & (PAGE_SIZE - 1);
+            if (page->entities[index] != entity)
+            {
+                return {nullptr, 0};
+            }
+            return {page, index};
+        }
+        
+        // Slot for entity, claimed if unused. The slot must not belong to another version
+        std::pair<Page*, size_t> Acquire(Entity entity)
+        {
+            const size_t id = static_cast<size_t>(entity.GetID());
+            const size_t pageIdx = id >> PAGE_SHIFT;
+            if (pageIdx >= m_pages.size())
+            {
+                m_pages.resize(pageIdx + 1);
+            }
+            
+            auto& page = m_pages[pageIdx];
+            if (!page)
+            {
+                page = std::make_unique<Page>();
+            }
+            
+            const size_t index = id & (PAGE_SIZE - 1);
+            if (page->entities[index] != entity)
+            {
+                ASTRA_ASSERT(!page->entities[index].IsValid(), "Relationship slot owned by another entity version");
+                page->entities[index] = entity;
+                ++page->liveCount;
+            }
+            return {page.get(), index};
+        }
+        
+        // Drop relationships left behind by an older version of the entity's ID
+        void EvictStale(Entity entity)
+        {
+            const size_t id = static_cast<size_t>(entity.GetID());
+            const size_t pageIdx = id >> PAGE_SHIFT;
+            if (pageIdx < m_pages.size() && m_pages[pageIdx])
+            {
+                Entity owner = m_pages[pageIdx]->entities[id & (PAGE_SIZE - 1)];
+                if (owner.IsValid() && owner != entity)
+                {
+                    OnEntityDestroyed(owner);
+                }
+            }
+        }
+        
+        void ReleaseIfEmpty(Entity entity)
+        {
+            auto [page, index] = Find(entity);
+            if (!page || page->parents[index].IsValid() || !page->children[index].empty() || !page->links[index].empty())
+                return;
+            
+            page->entities[index] = Entity::Invalid();
+            page->levelSlots[index] = NO_LEVEL;
+            page->children[index] = ChildrenContainer{};
+            page->links[index] = LinksContainer{};
+            
+            if (--page->liveCount == 0)
+            {
+                m_pages[static_cast<size_t>(entity.GetID()) >> PAGE_SHIFT].reset();
+            }
+        }
+        
+        void AddLinkTo(Entity from, Entity to)
+        {
+            auto [page, index] = Acquire(from);
+            auto& links = page->links[index];
+            if (links.empty())
+            {
+                ++m_linkedCount;
+            }
+            links.push_back(to);
+        }
+        
+        void RemoveLinkFrom(Entity from, Entity to)
+        {
+            auto [page, index] = Find(from);
+            ASTRA_ASSERT(page, "Link slot missing");
+            auto& links = page->links[index];
+            links.erase(std::find(links.begin(), links.end(), to));
+            if (links.empty())
+            {
+                --m_linkedCount;
+            }
+        }
+        
+        // Keep levels current for a leaf attach, anything that moves a subtree rebuilds lazily
+        void UpdateLevelsOnAttach(Entity child, Entity parent)
+        {
+            if (m_levelsDirty)
+                return;
+            
+            auto [childPage, childIndex] = Find(child);
+            auto [parentPage, parentIndex] = Find(parent);
+            if (!childPage->children[childIndex].empty())
+            {
+                m_levelsDirty = true;
+                return;
+            }
+            
+            if (parentPage->levelSlots[parentIndex] == NO_LEVEL)
+            {
+                // An unleveled parent with a parent of its own sits in a cycle
+                if (parentPage->parents[parentIndex].IsValid())
+                {
+                    m_levelsDirty = true;
+                    return;
+                }
+                AddToLevel(parent, 0);
+            }
+            
+            AddToLevel(child, parentPage->depths[parentIndex] + 1);
+        }
+        
+        void UpdateLevelsOnDetach(Entity child, Entity parent)
+        {
+            if (m_levelsDirty)
+                return;
+            
+            if (HasChildren(child))
+            {
+                m_levelsDirty = true;
+                return;
+            }
+            
+            RemoveFromLevel(child);
+            
+            // A root without children leaves the hierarchy
+            if (!HasParent(parent) && !HasChildren(parent))
+            {
+                RemoveFromLevel(parent);
+            }
+        }
+        
+        void AddToLevel(Entity entity, uint32_t depth)
+        {
+            auto [page, index] = Find(entity);
+            if (m_levels.size() <= depth)
+            {
+                m_levels.resize(depth + 1);
+            }
+            
+            page->depths[index] = depth;
+            page->levelSlots[index] = static_cast<uint32_t>(m_levels[depth].size());
+            m_levels[depth].push_back(entity);
+        }
+        
+        void RemoveFromLevel(Entity entity)
+        {
+            auto [page, index] = Find(entity);
+            if (!page || page->levelSlots[index] == NO_LEVEL)
+                return;
+            
+            auto& level = m_levels[page->depths[index]];
+            const uint32_t slot = page->levelSlots[index];
+            
+            // Swap-remove and patch the slot of the moved member
+            const Entity moved = level.back();
+            level[slot] = moved;
+            level.pop_back();
+            if (moved != entity)
+            {
+                auto [movedPage, movedIndex] = Find(moved);
+                movedPage->levelSlots[movedIndex] = slot;
+            }
+            page->levelSlots[index] = NO_LEVEL;
+            
+            while (!m_levels.empty() && m_levels.back().empty())
+            {
+                m_levels.pop_back();
+            }
+        }
+        
+        // Breadth-first from the roots, members only reachable through a cycle stay unleveled
+        void RebuildLevels()
+        {
+            m_levels.clear();
+            for (const auto& page : m_pages)
+            {
+                if (page)
+                {
+                    page->levelSlots.fill(NO_LEVEL);
+                }
+            }
+            
+            size_t memberCount = 0;
+            ForEachSlot([&](const Page& page, size_t index)
+            {
+                const bool hasChildren = !page.children[index].empty();
+                if (page.parents[index].IsValid() || hasChildren)
+                {
+                    ++memberCount;
+                }
+                if (!page.parents[index].IsValid() && hasChildren)
+                {
+                    AddToLevel(page.entities[index], 0);
+                }
+            });
+            
+            size_t leveledCount = 0;
+            for (size_t depth = 0; depth < m_levels.size(); ++depth)
+            {
+                leveledCount += m_levels[depth].size();
+                for (size_t i = 0; i < m_levels[depth].size(); ++i)
+                {
+                    for (Entity child : GetChildren(m_levels[depth][i]))
+                    {
+                        AddToLevel(child, static_cast<uint32_t>(depth + 1));
+                    }
+                }
+            }
+            
+            // Members unreachable from a root sit in a cycle
+            m_hasCycles = leveledCount != memberCount;
+            m_levelsDirty = false;
+        }
+        
+        void RebuildLinkSnapshot()
+        {
+            auto& snapshot = m_linkSnapshot;
+            snapshot.Clear();
+            snapshot.m_vertices.reserve(m_linkedCount);
+            snapshot.m_offsets.reserve(m_linkedCount + 1);
+            
+            // Vertices in ascending ID order, which GetVertex relies on for its binary search
+            size_t edgeCount = 0;
+            ForEachSlot([&](const Page& page, size_t index)
+            {
+                if (!page.links[index].empty())
+                {
+                    snapshot.m_vertices.push_back(page.entities[index]);
+                    edgeCount += page.links[index].size();
+                }
+            });
+            
+            snapshot.m_neighbors.reserve(edgeCount);
+            snapshot.m_offsets.push_back(0);
+            for (Entity vertex : snapshot.m_vertices)
+            {
+                for (Entity linked : GetLinks(vertex))
+                {
+                    snapshot.m_neighbors.push_back(snapshot.GetVertex(linked));
+                }
+                snapshot.m_offsets.push_back(static_cast<uint32_t>(snapshot.m_neighbors.size()));
+            }
+            
+            m_linksDirty = false;
+        }
+        
+        // Walk up from the new parent, reaching the child again means the link closed a cycle
+        void DetectCycle(Entity child, Entity parent)
+        {
+            size_t steps = 0;
+            for (Entity ancestor = parent; ancestor.IsValid(); ancestor = GetParent(ancestor))
+            {
+                // More steps than parent links means we are looping through an older cycle
+                if (ancestor == child || ++steps > m_childCount)
+                {
+                    m_hasCycles = true;
+                    return;
+                }
+            }
+        }
+        
+        // Visit live slots in ascending ID order
+        template<typename Func>
+        void ForEachSlot(Func&& func) const
+        {
+            for (const auto& page : m_pages)
+            {
+                if (!page)
+                    continue;
+                
+                for (size_t index = 0; index < PAGE_SIZE; ++index)
+                {
+                    if (page->entities[index].IsValid())
+                    {
+                        func(*page, index);
+                    }
+                }
+            }
+        }
+        
+        std::vector<std::unique_ptr<Page>> m_pages;  // Indexed by id >> PAGE_SHIFT, null while empty
+        size_t m_childCount = 0;                     // Entities with a parent
+        size_t m_parentCount = 0;                    // Entities with children
+        size_t m_linkedCount = 0;                    // Entities with links
+        
+        // Hierarchy members by depth, see GetLevels
+        std::vector<std::vector<Entity>> m_levels;
+        bool m_levelsDirty = false;
+        bool m_hasCycles = false;
+        
+        // Cached CSR copy of the links, see BuildLinkSnapshot
+        LinkSnapshot m_linkSnapshot;
+        bool m_linksDirty = false;
         
         // Empty containers for const references
         static inline const ChildrenContainer s_emptyChildren{};
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Container/Bitmap.hpp"
+#include "../Core/Base.hpp"
+
+namespace Astra
+{
+    using ResourceID = std::uint16_t;
+    
+    // Allow users to override the maximum number of resource types
+    // Usage: #define ASTRA_MAX_RESOURCES 128 before including Astra
+    #ifndef ASTRA_MAX_RESOURCES
+        #define ASTRA_MAX_RESOURCES 64u
+    #endif
+    
+    constexpr std::size_t MAX_RESOURCES = ASTRA_MAX_RESOURCES;
+    
+    // Resource mask for tracking which resources a system touches
+    using ResourceMask = Bitmap<MAX_RESOURCES>;
+    
+    namespace Detail
+    {
+        // Resources get their own dense ID sequence, separate from TypeID, so the storage array and
+        // scheduler masks stay small no matter how many other types have IDs
+        class ResourceIDGenerator
+        {
+        public:
+            ASTRA_NODISCARD static ResourceID Next() noexcept
+            {
+                return s_nextId.fetch_add(1, std::memory_order_relaxed);
+            }
+        
+        private:
+            inline static std::atomic<ResourceID> s_nextId{0};
+        };
+        
+        template<typename T>
+        class ResourceIDStorage
+        {
+        public:
+            ASTRA_NODISCARD static ResourceID Value() noexcept
+            {
+                static const ResourceID s_id = ResourceIDGenerator::Next();
+                return s_id;
+            }
+        };
+    }
+    
+    template<typename T>
+    struct ResourceTypeID
+    {
+        using Type = std::decay_t<T>;
+        
+        ASTRA_NODISCARD static ResourceID Value() noexcept
+        {
+            return Detail::ResourceIDStorage<Type>::Value();
+        }
+    };
+    
+    template<typename... Resources>
+    ASTRA_NODISCARD ResourceMask MakeResourceMask() noexcept
+    {
+        ResourceMask mask{};
+        ((mask.Set(ResourceTypeID<Resources>::Value())), ...);
+        return mask;
+    }
+    
+    /**
+     * Singleton values stored outside of entity storage
+     * Each resource type owns one slot in a dense array indexed by its ResourceID, so a lookup is
+     * a bounds check and a single load.
+     */
+    class ResourceStorage
+    {
+    public:
+        ResourceStorage() = default;
+        ~ResourceStorage() { Clear(); }
+        
+        ResourceStorage(const ResourceStorage&) = delete;
+        ResourceStorage& operator=(const ResourceStorage&) = delete;
+        
+        ResourceStorage(ResourceStorage&& other) noexcept :
+            m_slots(std::move(other.m_slots))
+        {
+            other.m_slots.clear();
+        }
+        
+        ResourceStorage& operator=(ResourceStorage&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Clear();
+                m_slots.swap(other.m_slots);
+            }
+            return *this;
+        }
+        
+        /**
+         * Construct a resource, replacing any existing value of the same type
+         */
+        template<typename T, typename... Args>
+        T& Emplace(Args&&... args)
+        {
+            static_assert(std::is_same_v<T, std::decay_t<T>>, "Resources must be stored by value");
+            
+            const ResourceID id = ResourceTypeID<T>::Value();
+            ASTRA_ASSERT(id < MAX_RESOURCES, "Too many resource types, raise ASTRA_MAX_RESOURCES");
+            if (id >= m_slots.size())
+            {
+                m_slots.resize(id + 1);
+            }
+            
+            auto* resource = new T(std::forward<Args>(args)...);
+            Reset(m_slots[id]);
+            m_slots[id] = Slot{resource, [](void* ptr) { delete static_cast<T*>(ptr); }};
+            return *resource;
+        }
+        
+        template<typename T>
+        ASTRA_NODISCARD T* Get() noexcept
+        {
+            const ResourceID id = ResourceTypeID<T>::Value();
+            return id < m_slots.size() ? static_cast<T*>(m_slots[id].data) : nullptr;
+        }
+        
+        template<typename T>
+        ASTRA_NODISCARD const T* Get() const noexcept
+        {
+            const ResourceID id = ResourceTypeID<T>::Value();
+            return id < m_slots.size() ? static_cast<const T*>(m_slots[id].data) : nullptr;
+        }
+        
+        template<typename T>
+        ASTRA_NODISCARD bool Contains() const noexcept
+        {
+            return Get<T>() != nullptr;
+        }
+        
+        /**
+         * Destroy a resource
+         * @return true if the resource existed
+         */
+        template<typename T>
+        bool Remove() noexcept
+        {
+            const ResourceID id = ResourceTypeID<T>::Value();
+            if (id >= m_slots.size() || !m_slots[id].data)
+            {
+                return false;
+            }
+            Reset(m_slots[id]);
+            return true;
+        }
+        
+        ASTRA_NODISCARD size_t Size() const noexcept
+        {
+            size_t count = 0;
+            for (const Slot& slot : m_slots)
+            {
+                count += slot.data ? 1 : 0;
+            }
+            return count;
+        }
+        
+        void Clear() noexcept
+        {
+            for (Slot& slot : m_slots)
+            {
+                Reset(slot);
+            }
+            m_slots.clear();
+        }
+    
+    private:
+        struct Slot
+        {
+            void* data = nullptr;
+            void (*destroy)(void*) = nullptr;
+        };
+        
+        static void Reset(Slot& slot) noexcept
+        {
+            if (slot.data)
+            {
+                slot.destroy(slot.data);
+                slot = Slot{};
+            }
+        }
+        
+        std::vector<Slot> m_slots;
+    };
+}
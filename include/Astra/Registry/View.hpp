@@ -12,7 +12,9 @@
 #include "../Archetype/Archetype.hpp"
 #include "../Archetype/ArchetypeManager.hpp"
 #include "../Component/Component.hpp"
+#include "../Core/JobSystem.hpp"
 #include "../Entity/Entity.hpp"
+#include "ChunkView.hpp"
 #include "Query.hpp"
 
 namespace Astra
@@ -32,111 +34,204 @@ namespace Astra
         static constexpr size_t MIN_ENTITIES_FOR_PARALLEL = MIN_CHUNKS_FOR_PARALLEL * AVG_ENTITIES_PER_CHUNK / 2;  // ~4 chunks worth
         
     public:
-        explicit View(std::shared_ptr<ArchetypeManager> manager) :
+        // Matching archetypes come from the manager's query cache, so creating a view is a lookup.
+        // Each iteration copies the list only when the query changed since the last one, the view
+        // never reads the shared list while a structural change on another thread may modify it.
+        // Parallel iteration runs on jobSystem when given, otherwise on short-lived threads.
+        explicit View(std::shared_ptr<ArchetypeManager> manager, std::shared_ptr<JobSystem> jobSystem = nullptr) :
             m_archetypeManager(std::move(manager)),
-            m_lastRefreshCounter(0),
-            m_lastGeneration(0)
-        {
-            CollectArchetypes();
-            m_lastRefreshCounter = m_archetypeManager->GetStructuralChangeCounter();
-            m_lastGeneration = m_archetypeManager->GetCurrentGeneration();
-        }
+            m_query(&m_archetypeManager->GetQuery(&QueryBuilder::Matches, QueryBuilder::GetRequiredMask())),
+            m_jobSystem(std::move(jobSystem))
+        {}
 
         template<typename Func>
         ASTRA_FORCEINLINE void ForEach(Func&& func)
         {
-            EnsureArchetypes();
-            
-            if (m_archetypes.empty()) ASTRA_UNLIKELY
-                return;
-            
-            for (Archetype* archetype : m_archetypes)
+            // Indexed, archetypes created by the callback are appended and not visited
+            const auto& archetypes = SyncArchetypes();
+            const size_t count = archetypes.size();
+            for (size_t i = 0; i < count; ++i)
             {
-                ForEachImpl(archetype, std::forward<Func>(func), RequiredTypes{}, OptionalTypes{});
+                ForEachImpl(archetypes[i], std::forward<Func>(func), RequiredTypes{}, OptionalTypes{});
             }
         }
         
         template<typename Func>
         ASTRA_FORCEINLINE void ParallelForEach(Func&& func)
         {
-            EnsureArchetypes();
-            
-            if (m_archetypes.empty()) ASTRA_UNLIKELY
-                return;
-            
-            // Quick check: if we have very few matching entities, don't even try parallel
-            size_t quickCount = 0;
-            for (Archetype* archetype : m_archetypes)
+            std::vector<std::pair<Archetype*, size_t>> chunkWork;
+            if (!CollectParallelChunks(chunkWork))
             {
-                quickCount += archetype->GetEntityCount();
+                return ForEach(std::forward<Func>(func));
             }
             
-            if (quickCount < MIN_ENTITIES_QUICK_CHECK)
+            DispatchChunks(chunkWork, [this, &func](Archetype* archetype, size_t chunkIndex)
             {
-                return ForEach(std::forward<Func>(func));
+                ParallelForEachChunkImpl(archetype, chunkIndex, func, RequiredTypes{}, OptionalTypes{});
+            });
+        }
+        
+        /**
+         * Visit each non-empty matching chunk as a ChunkView<QueryArgs...>
+         * The callback gets contiguous columns, for hand-written loops over whole chunks
+         */
+        template<typename Func>
+        void ForEachChunk(Func&& func)
+        {
+            const auto& archetypes = SyncArchetypes();
+            const size_t count = archetypes.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                Archetype* archetype = archetypes[i];
+                const size_t chunkCount = archetype->GetChunkCount();
+                for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+                {
+                    if (archetype->GetChunkEntityCount(chunkIndex) > 0)
+                    {
+                        func(MakeChunkView(archetype, chunkIndex, RequiredTypes{}, OptionalTypes{}));
+                    }
+                }
             }
-            
+        }
+        
+        /**
+         * Visit matching entities LANES at a time as LaneView<T, Width> runs of each column
+         * Called as func(std::span<const Entity>, LaneView<Required, Width>..., LaneView<Optional, Width>...),
+         * each chunk is split into full runs followed by one masked tail run
+         */
+        template<Simd::SimdWidth Width = Simd::NativeWidth, typename Func>
+        void ForEachSimd(Func&& func)
+        {
+            ForEachChunk([&func](const ChunkView<QueryArgs...>& chunk)
+            {
+                ForEachLaneRun<Width>(chunk, func, RequiredTypes{}, OptionalTypes{});
+            });
+        }
+        
+        /**
+         * ForEachChunk with chunks spread across threads
+         * Chunks are disjoint, so callbacks may write any column of their own chunk
+         */
+        template<typename Func>
+        void ParallelForEachChunk(Func&& func)
+        {
             std::vector<std::pair<Archetype*, size_t>> chunkWork;
-            // Better estimation based on typical entities per 16KB chunk
-            size_t estimatedChunks = (quickCount / AVG_ENTITIES_PER_CHUNK) + m_archetypes.size();
-            chunkWork.reserve(estimatedChunks);
-            size_t totalMatchingEntities = 0;
-            
-            for (Archetype* archetype : m_archetypes)
+            for (Archetype* archetype : SyncArchetypes())
             {
-                size_t chunkCount = archetype->GetChunkCount();
-                for (size_t i = 0; i < chunkCount; ++i)
+                const size_t chunkCount = archetype->GetChunkCount();
+                for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
                 {
-                    size_t chunkEntityCount = archetype->GetChunkEntityCount(i);
-                    if (chunkEntityCount > 0)
+                    if (archetype->GetChunkEntityCount(chunkIndex) > 0)
                     {
-                        chunkWork.emplace_back(archetype, i);
-                        totalMatchingEntities += chunkEntityCount;
+                        chunkWork.emplace_back(archetype, chunkIndex);
                     }
                 }
             }
             
-            // Fall back to sequential for tiny workloads
-            if (chunkWork.empty() || 
-                totalMatchingEntities < MIN_ENTITIES_FOR_PARALLEL || 
-                chunkWork.size() < MIN_CHUNKS_FOR_PARALLEL)
+            if (chunkWork.size() < MIN_CHUNKS_FOR_PARALLEL)
             {
-                return ForEach(std::forward<Func>(func));
+                for (auto [archetype, chunkIndex] : chunkWork)
+                {
+                    func(MakeChunkView(archetype, chunkIndex, RequiredTypes{}, OptionalTypes{}));
+                }
+                return;
             }
             
-            // Determine optimal thread count ensuring each thread gets meaningful work
-            const size_t hardwareConcurrency = std::thread::hardware_concurrency();
-            const size_t maxThreadsByWork = chunkWork.size() / MIN_CHUNKS_PER_THREAD;
-            const size_t numWorkers = std::min(hardwareConcurrency, std::max(size_t(1), maxThreadsByWork));
+            DispatchChunks(chunkWork, [&func](Archetype* archetype, size_t chunkIndex)
+            {
+                func(MakeChunkView(archetype, chunkIndex, RequiredTypes{}, OptionalTypes{}));
+            });
+        }
+        
+        /**
+         * Fold every matching entity into a value, in parallel
+         * 
+         * Each chunk gets its own accumulator starting at identity, filled by
+         * map(T& accumulator, Entity, Components&...). The chunk results are then merged with
+         * combine(T, T) -> T in chunk order, so the result is the same for any thread count,
+         * including the sequential fallback for small views. Accumulators sit on separate cache
+         * lines, workers never write to a shared line.
+         * 
+         * @code
+         * float total = view.ParallelReduce(0.0f,
+         *     [](float& sum, Entity, const Health& health) { sum += health.current; },
+         *     [](float a, float b) { return a + b; });
+         * @endcode
+         */
+        template<typename T, typename MapFunc, typename CombineFunc>
+        ASTRA_NODISCARD T ParallelReduce(T identity, MapFunc&& map, CombineFunc&& combine)
+        {
+            std::vector<std::pair<Archetype*, size_t>> chunkWork;
+            const bool parallel = CollectParallelChunks(chunkWork);
             
-            std::atomic<size_t> nextChunkIndex{0};
-            std::vector<std::future<void>> futures;
-            futures.reserve(numWorkers);
+            std::vector<PaddedAccumulator<T>> partials(chunkWork.size(), PaddedAccumulator<T>{identity});
+            auto reduceChunk = [this, &chunkWork, &partials, &map](size_t item)
+            {
+                T& accumulator = partials[item].value;
+                auto [archetype, chunkIndex] = chunkWork[item];
+                ParallelForEachChunkImpl(archetype, chunkIndex, [&accumulator, &map](Entity entity, auto&&... components)
+                {
+                    map(accumulator, entity, components...);
+                }, RequiredTypes{}, OptionalTypes{});
+            };
             
-            for (size_t t = 0; t < numWorkers; ++t)
+            if (parallel)
             {
-                futures.push_back(std::async(std::launch::async,
-                    [this, &func, &chunkWork, &nextChunkIndex]()
-                    {
-                        size_t chunkIdx;
-                        while ((chunkIdx = nextChunkIndex.fetch_add(1, std::memory_order_relaxed)) < chunkWork.size())
-                        {
-                            auto [archetype, chunkIndex] = chunkWork[chunkIdx];
-                            ParallelForEachChunkImpl(archetype, chunkIndex, func, RequiredTypes{}, OptionalTypes{});
-                        }
-                    }));
+                DispatchWorkItems(chunkWork.size(), reduceChunk);
+            }
+            else
+            {
+                for (size_t item = 0; item < chunkWork.size(); ++item)
+                {
+                    reduceChunk(item);
+                }
             }
             
-            for (auto& future : futures)
+            T result = std::move(identity);
+            for (auto& partial : partials)
             {
-                future.wait();
+                result = combine(std::move(result), std::move(partial.value));
             }
+            return result;
+        }
+        
+        /**
+         * Map every matching entity to a value and reduce the values, in parallel
+         * 
+         * Like ParallelReduce, with transform(Entity, Components&...) -> T per entity and
+         * reduce(T, T) -> T for both values and chunk results, as std::transform_reduce.
+         * 
+         * @code
+         * size_t alive = view.ParallelTransformReduce(size_t(0),
+         *     [](Entity, const Health& health) { return size_t(health.current > 0); },
+         *     std::plus<>{});
+         * @endcode
+         */
+        template<typename T, typename TransformFunc, typename ReduceFunc>
+        ASTRA_NODISCARD T ParallelTransformReduce(T identity, TransformFunc&& transform, ReduceFunc&& reduce)
+        {
+            return ParallelReduce(std::move(identity),
+                [&transform, &reduce](T& accumulator, Entity entity, auto&&... components)
+                {
+                    accumulator = reduce(std::move(accumulator), transform(entity, components...));
+                },
+                reduce);
+        }
+        
+        /**
+         * Get the ChunkView of one chunk of an archetype matching the query
+         * For callers that schedule the chunks themselves, e.g. chunk-local systems
+         */
+        ASTRA_NODISCARD static ChunkView<QueryArgs...> GetChunkView(Archetype* archetype, size_t chunkIndex)
+        {
+            ASTRA_ASSERT(QueryBuilder::Matches(archetype->GetMask()), "Archetype does not match the view");
+            return MakeChunkView(archetype, chunkIndex, RequiredTypes{}, OptionalTypes{});
         }
         
         ASTRA_NODISCARD size_t Size() const noexcept
         {
             size_t total = 0;
-            for (const auto* archetype : m_archetypes)
+            for (const auto* archetype : SyncArchetypes())
             {
                 total += archetype->GetEntityCount();
             }
@@ -145,7 +240,10 @@ namespace Astra
 
         ASTRA_NODISCARD bool Empty() const noexcept
         {
-            return m_archetypes.empty();
+            // Cached lists keep empty archetypes, so look at entity counts
+            const auto& archetypes = SyncArchetypes();
+            return std::none_of(archetypes.begin(), archetypes.end(),
+                [](const Archetype* archetype) { return archetype->GetEntityCount() > 0; });
         }
 
         class iterator
@@ -303,14 +401,12 @@ namespace Astra
 
         iterator begin() 
         { 
-            EnsureArchetypes();
-            return iterator(m_archetypes); 
+            return iterator(SyncArchetypes()); 
         }
         iterator end() { return iterator(); }
         const_iterator begin() const 
         { 
-            const_cast<View*>(this)->EnsureArchetypes();
-            return iterator(m_archetypes); 
+            return iterator(SyncArchetypes()); 
         }
         const_iterator end() const { return iterator(); }
         
@@ -324,69 +420,126 @@ namespace Astra
         using IterationComponents = decltype(CombineTypes(RequiredTypes{}, OptionalTypes{}));
 
         static constexpr size_t COMPONENT_COUNT = std::tuple_size_v<IterationComponents>;
-
-        struct ArchetypeEntityCountComparator
+        
+        // One reduction partial per cache line, so workers filling neighbouring slots never share a line
+        template<typename T>
+        struct alignas(CACHE_LINE_SIZE) PaddedAccumulator
         {
-            bool operator()(Archetype* a, Archetype* b) const
-            {
-                return a->GetEntityCount() > b->GetEntityCount();
-            }
+            T value;
         };
-
-        void EnsureArchetypes()
+        
+        // Collect the non-empty matching chunks, false when the workload is too small for threads
+        bool CollectParallelChunks(std::vector<std::pair<Archetype*, size_t>>& chunkWork) const
         {
-            uint32_t currentCounter = m_archetypeManager->GetStructuralChangeCounter();
-            if (m_lastRefreshCounter == currentCounter)
-            {
-                return;
-            }
+            const auto& archetypes = SyncArchetypes();
             
-            if (m_lastGeneration == 0)
+            // Quick check: if we have very few matching entities, don't even try parallel
+            size_t quickCount = 0;
+            for (Archetype* archetype : archetypes)
             {
-                CollectArchetypes();
+                quickCount += archetype->GetEntityCount();
             }
-            else
+            
+            // Better estimation based on typical entities per 16KB chunk
+            size_t estimatedChunks = (quickCount / AVG_ENTITIES_PER_CHUNK) + archetypes.size();
+            chunkWork.reserve(estimatedChunks);
+            size_t totalMatchingEntities = 0;
+            
+            for (Archetype* archetype : archetypes)
             {
-                auto newArchetypes = m_archetypeManager->GetArchetypesSince(m_lastGeneration);
-                for (Archetype* arch : newArchetypes)
+                size_t chunkCount = archetype->GetChunkCount();
+                for (size_t i = 0; i < chunkCount; ++i)
                 {
-                    if (arch->GetEntityCount() == 0) ASTRA_UNLIKELY
-                    {
-                        continue;
-                    }
-                    if (QueryBuilder::Matches(arch->GetMask()))
+                    size_t chunkEntityCount = archetype->GetChunkEntityCount(i);
+                    if (chunkEntityCount > 0)
                     {
-                        m_archetypes.push_back(arch);
+                        chunkWork.emplace_back(archetype, i);
+                        totalMatchingEntities += chunkEntityCount;
                     }
                 }
-                
-                std::sort(m_archetypes.begin(), m_archetypes.end(), ArchetypeEntityCountComparator{});
             }
             
-            m_lastRefreshCounter = currentCounter;
-            m_lastGeneration = m_archetypeManager->GetCurrentGeneration();
+            // Fall back to sequential for tiny workloads
+            return quickCount >= MIN_ENTITIES_QUICK_CHECK &&
+                totalMatchingEntities >= MIN_ENTITIES_FOR_PARALLEL &&
+                chunkWork.size() >= MIN_CHUNKS_FOR_PARALLEL;
         }
         
-        void CollectArchetypes()
+        // Runs perChunk over the work list on worker threads that claim chunks one at a time
+        template<typename ChunkFunc>
+        void DispatchChunks(const std::vector<std::pair<Archetype*, size_t>>& chunkWork, ChunkFunc&& perChunk)
         {
-            auto archetypes = m_archetypeManager->GetAllArchetypes();
-            const size_t queryComponentCount = QueryBuilder::GetRequiredMask().Count();
-            
-            m_archetypes.reserve(archetypes.size());
+            DispatchWorkItems(chunkWork.size(), [&perChunk, &chunkWork](size_t item)
+            {
+                auto [archetype, chunkIndex] = chunkWork[item];
+                perChunk(archetype, chunkIndex);
+            });
+        }
+        
+        // Hand out work items [0, count) one at a time to the job system or to async threads
+        template<typename ItemFunc>
+        void DispatchWorkItems(size_t count, ItemFunc&& perItem)
+        {
+            // Determine optimal thread count ensuring each thread gets meaningful work
+            const size_t hardwareConcurrency = m_jobSystem ? m_jobSystem->GetWorkerCount() + 1 : std::thread::hardware_concurrency();
+            const size_t maxThreadsByWork = count / MIN_CHUNKS_PER_THREAD;
+            const size_t numWorkers = std::min(hardwareConcurrency, std::max(size_t(1), maxThreadsByWork));
             
-            for (Archetype* archetype : archetypes)
+            std::atomic<size_t> nextItem{0};
+            auto worker = [&perItem, count, &nextItem](size_t)
             {
-                if (archetype->GetEntityCount() == 0 || archetype->GetComponentCount() < queryComponentCount) ASTRA_UNLIKELY
+                size_t item;
+                while ((item = nextItem.fetch_add(1, std::memory_order_relaxed)) < count)
                 {
-                    continue;
-                }
-                if (QueryBuilder::Matches(archetype->GetMask()))
-                {
-                    m_archetypes.push_back(archetype);
+                    perItem(item);
                 }
+            };
+            
+            if (m_jobSystem)
+            {
+                m_jobSystem->ParallelFor(numWorkers, worker);
+                return;
+            }
+            
+            std::vector<std::future<void>> futures;
+            futures.reserve(numWorkers);
+            for (size_t t = 0; t < numWorkers; ++t)
+            {
+                futures.push_back(std::async(std::launch::async, worker, t));
             }
             
-            std::sort(m_archetypes.begin(), m_archetypes.end(), ArchetypeEntityCountComparator{});
+            for (auto& future : futures)
+            {
+                future.wait();
+            }
+        }
+        
+        template<Simd::SimdWidth Width, typename Func, typename... Required, typename... Optional>
+        ASTRA_FORCEINLINE static void ForEachLaneRun(const ChunkView<QueryArgs...>& chunk, Func& func, std::tuple<Required...>, std::tuple<Optional...>)
+        {
+            constexpr size_t LANES = LaneView<Entity, Width>::LANES;
+            
+            const std::tuple<Required*...> requiredPtrs{chunk.template Get<Required>().data()...};
+            const std::tuple<Optional*...> optionalPtrs{chunk.template Get<Optional>().data()...};
+            const Entity* entities = chunk.GetEntities().data();
+            const size_t count = chunk.Size();
+            
+            for (size_t i = 0; i < count; i += LANES)
+            {
+                const size_t lanes = std::min(LANES, count - i);
+                func(std::span<const Entity>(entities + i, lanes),
+                    LaneView<Required, Width>(std::get<Required*>(requiredPtrs) + i, lanes)...,
+                    LaneView<Optional, Width>(std::get<Optional*>(optionalPtrs) ? std::get<Optional*>(optionalPtrs) + i : nullptr, lanes)...);
+            }
+        }
+        
+        template<typename... Required, typename... Optional>
+        ASTRA_FORCEINLINE static ChunkView<QueryArgs...> MakeChunkView(Archetype* archetype, size_t chunkIndex, std::tuple<Required...>, std::tuple<Optional...>)
+        {
+            auto& chunk = archetype->GetChunks()[chunkIndex];
+            return ChunkView<QueryArgs...>(chunk->GetEntities().data(), chunk->GetCount(),
+                typename ChunkView<QueryArgs...>::RequiredColumns{chunk->template GetComponentArray<Required>()...},
+                typename ChunkView<QueryArgs...>::OptionalColumns{(archetype->HasComponent<Optional>() ? chunk->template GetComponentArray<Optional>() : nullptr)...});
         }
 
         template<typename Func, typename... Required, typename... Optional>
@@ -490,10 +643,17 @@ namespace Astra
             }
         }
 
-        std::vector<Archetype*> m_archetypes;
+        // The view's own copy of the query's archetypes, refreshed when the query's version moves
+        const std::vector<Archetype*>& SyncArchetypes() const
+        {
+            m_archetypeManager->CopyQueryArchetypes(*m_query, m_archetypes, m_queryVersion);
+            return m_archetypes;
+        }
+
         std::shared_ptr<ArchetypeManager> m_archetypeManager;
-        
-        uint32_t m_lastRefreshCounter = 0;
-        uint32_t m_lastGeneration = 0;
+        const ArchetypeManager::CachedQuery* m_query;  // Owned by the manager's query cache
+        mutable std::vector<Archetype*> m_archetypes;
+        mutable uint64_t m_queryVersion = 0;
+        std::shared_ptr<JobSystem> m_jobSystem;  // Shared with the registry, so the pool outlives the view
     };
 } // namespace Astra
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 #include "../Core/Base.hpp"
 #include "../Core/Result.hpp"
+#include "../Entity/Entity.hpp"
+#include "../Platform/CpuDispatch.hpp"
 #include "../Platform/Simd.hpp"
 #include "SerializationError.hpp"
 
@@ -20,11 +22,38 @@ namespace Astra
     namespace Checksum
     {
         /**
-         * Calculate CRC32 for a buffer
-         * Uses hardware CRC32 instructions when available
+         * Calculate CRC-32C for a buffer
+         * Uses the crc32 instructions when the running CPU has them, selected at runtime, with
+         * identical results on every host
          */
         inline uint32_t CRC32(const void* data, size_t size, uint32_t crc = 0)
         {
+            return Simd::Dispatch::Crc32c(data, size, crc);
+        }
+        
+        /**
+         * Checksum used by format v1 and v2 archives
+         * Combines 8-byte words the way those builds did; frozen here so later changes to
+         * Simd::Ops::HashCombine cannot break verifying older archives
+         */
+        inline uint32_t LegacyCRC32(const void* data, size_t size, uint32_t crc = 0)
+        {
+            auto combine = [](uint64_t seed, uint64_t value) -> uint64_t
+            {
+#if defined(ASTRA_HAS_ARM_CRC32)
+                return __crc32cd(static_cast<uint32_t>(seed), value);
+#else
+                // MurmurHash3 finalizer
+                uint64_t h = seed ^ value;
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+                return h;
+#endif
+            };
+            
             const uint8_t* bytes = static_cast<const uint8_t*>(data);
             uint64_t result = crc;
             
@@ -33,7 +62,7 @@ namespace Astra
             {
                 uint64_t value;
                 std::memcpy(&value, bytes, sizeof(uint64_t));
-                result = Simd::Ops::HashCombine(result, value);
+                result = combine(result, value);
                 bytes += 8;
                 size -= 8;
             }
@@ -43,7 +72,7 @@ namespace Astra
             {
                 uint64_t value = 0;
                 std::memcpy(&value, bytes, size);
-                result = Simd::Ops::HashCombine(result, value);
+                result = combine(result, value);
             }
             
             return static_cast<uint32_t>(result);
@@ -53,8 +82,10 @@ namespace Astra
     /**
      * Binary format version history:
      * v1: Initial format with component hashing and compression support
+     * v2: Archetypes carry their relationship pair, registry stores its pair config
+     * v3: Data checksum is CRC-32C
      */
-    inline constexpr uint16_t BINARY_FORMAT_VERSION = 1;
+    inline constexpr uint16_t BINARY_FORMAT_VERSION = 3;
     inline constexpr char BINARY_MAGIC[6] = "ASTRA";
     
     /**
@@ -83,8 +114,9 @@ namespace Astra
         uint32_t entityCount;        // Total entity count - 4 bytes
         uint32_t dataChecksum;       // CRC32 of data after header - 4 bytes
         uint8_t compressionMode;     // CompressionMode enum - 1 byte
-        uint8_t reserved[11];        // Reserved for future expansion - 11 bytes
-        // Total: 5 + 2 + 1 + 4 + 4 + 4 + 1 + 11 = 32 bytes
+        uint8_t entityBits;          // Entity handle width, 0 = legacy 32-bit - 1 byte
+        uint8_t reserved[10];        // Reserved for future expansion - 10 bytes
+        // Total: 5 + 2 + 1 + 4 + 4 + 4 + 1 + 1 + 10 = 32 bytes
         
         BinaryHeader() noexcept
         {
@@ -95,6 +127,7 @@ namespace Astra
             entityCount = 0;
             dataChecksum = 0;
             compressionMode = static_cast<uint8_t>(CompressionMode::None);
+            entityBits = static_cast<uint8_t>(ENTITY_BITS);
             std::memset(reserved, 0, sizeof(reserved));
         }
         
@@ -113,6 +146,13 @@ namespace Astra
             return endianness == (IsLittleEndian() ? 0 : 1);
         }
         
+        [[nodiscard]] bool IsEntityWidthCompatible() const noexcept
+        {
+            // Archives written before the field existed always used 32-bit handles
+            const size_t bits = entityBits == 0 ? 32 : entityBits;
+            return bits == ENTITY_BITS;
+        }
+        
         [[nodiscard]] bool IsCompressed() const noexcept
         {
             return compressionMode != static_cast<uint8_t>(CompressionMode::None);
@@ -128,7 +128,9 @@ namespace Astra
             // Update checksum if enabled and we're past the header
             if (m_checksumEnabled && m_position >= m_headerSize && m_headerSize > 0)
             {
-                m_runningChecksum = Checksum::CRC32(data, size, m_runningChecksum);
+                m_runningChecksum = m_version >= 3
+                    ? Checksum::CRC32(data, size, m_runningChecksum)
+                    : Checksum::LegacyCRC32(data, size, m_runningChecksum);
             }
             
             m_position += size;
@@ -165,6 +167,12 @@ namespace Astra
                 return Result<BinaryHeader, SerializationError>::Err(SerializationError::EndiannessMismatch);
             }
             
+            if (!header.IsEntityWidthCompatible())
+            {
+                m_error = SerializationError::EntityWidthMismatch;
+                return Result<BinaryHeader, SerializationError>::Err(SerializationError::EntityWidthMismatch);
+            }
+            
             m_version = header.version;
             m_headerSize = sizeof(BinaryHeader);
             m_expectedChecksum = header.dataChecksum;
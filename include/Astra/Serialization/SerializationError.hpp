@@ -18,6 +18,7 @@ namespace Astra
         EndiannessMismatch,
         ChecksumMismatch,
         IOError,
-        OutOfMemory
+        OutOfMemory,
+        EntityWidthMismatch
     };
 }
\ No newline at end of file
@@ -10,6 +10,101 @@
 
 namespace Astra
 {
+    namespace Detail
+    {
+        template<typename T>
+        struct IsView : std::false_type {};
+        
+        template<typename... QueryArgs>
+        struct IsView<View<QueryArgs...>> : std::true_type {};
+        
+        // View type taken by an operator()(Registry&, View<...>&), void for any other signature
+        template<typename MemberFunction>
+        struct SystemViewParameter
+        {
+            using type = void;
+        };
+        
+        template<typename Ret, typename Class, typename ViewArg>
+        struct SystemViewParameter<Ret(Class::*)(Registry&, ViewArg)>
+        {
+            using type = std::remove_cvref_t<ViewArg>;
+        };
+        
+        template<typename Ret, typename Class, typename ViewArg>
+        struct SystemViewParameter<Ret(Class::*)(Registry&, ViewArg) const>
+        {
+            using type = std::remove_cvref_t<ViewArg>;
+        };
+        
+        template<typename T>
+        struct IsChunkView : std::false_type {};
+        
+        template<typename... QueryArgs>
+        struct IsChunkView<ChunkView<QueryArgs...>> : std::true_type {};
+        
+        // View matching the ChunkView taken by an operator()(ChunkView<...>), void for any other signature
+        template<typename MemberFunction>
+        struct SystemChunkParameter
+        {
+            using type = void;
+        };
+        
+        template<typename Ret, typename Class, typename ChunkArg>
+        requires IsChunkView<std::remove_cvref_t<ChunkArg>>::value
+        struct SystemChunkParameter<Ret(Class::*)(ChunkArg)>
+        {
+            using type = typename std::remove_cvref_t<ChunkArg>::ViewType;
+        };
+        
+        template<typename Ret, typename Class, typename ChunkArg>
+        requires IsChunkView<std::remove_cvref_t<ChunkArg>>::value
+        struct SystemChunkParameter<Ret(Class::*)(ChunkArg) const>
+        {
+            using type = typename std::remove_cvref_t<ChunkArg>::ViewType;
+        };
+        
+        template<typename ViewType>
+        struct SystemViewFactory;
+        
+        template<typename... QueryArgs>
+        struct SystemViewFactory<View<QueryArgs...>>
+        {
+            static View<QueryArgs...> Create(Registry& registry)
+            {
+                return registry.CreateView<QueryArgs...>();
+            }
+        };
+    }
+    
+    /**
+     * @brief Concept for systems that receive their view from the scheduler
+     * 
+     * The system's operator() takes (Registry&, View<...>&); the scheduler creates the view for
+     * each run and derives the system's component access from the view's arguments.
+     */
+    template<typename T>
+    concept ViewSystem = requires { &T::operator(); } &&
+        Detail::IsView<typename Detail::SystemViewParameter<decltype(&T::operator())>::type>::value;
+    
+    template<ViewSystem T>
+    using SystemViewType = typename Detail::SystemViewParameter<decltype(&T::operator())>::type;
+    
+    /**
+     * @brief Concept for chunk-local systems
+     * 
+     * The system's operator() takes a single ChunkView<...> and may only touch the rows of that
+     * chunk. Opting in lets a JobSystemExecutor split the system into one job per chunk and run a
+     * dependent chunk-local system on a chunk as soon as its predecessors finished that chunk,
+     * instead of waiting for them to finish every chunk.
+     */
+    template<typename T>
+    concept ChunkSystem = requires { &T::operator(); } &&
+        Detail::IsView<typename Detail::SystemChunkParameter<decltype(&T::operator())>::type>::value;
+    
+    template<ChunkSystem T>
+    using ChunkSystemViewType = typename Detail::SystemChunkParameter<decltype(&T::operator())>::type;
+    
     /**
      * @brief Concept that defines what constitutes a System in Astra ECS
      * 
@@ -20,25 +115,49 @@ namespace Astra
      * - Function pointers
      * - std::function
      * 
-     * The only requirement is that it must be invocable with a Registry& parameter.
+     * It must be invocable with a Registry& parameter, be a ViewSystem taking a
+     * Registry& and the view it iterates, or be a ChunkSystem taking one chunk.
      */
     template<typename T>
     concept System = requires(T system, Registry& registry)
     {
         { system(registry) } -> std::same_as<void>;
-    };
+    } || ViewSystem<T> || ChunkSystem<T>;
     
     /**
-     * @brief Helper template to define component access patterns for systems
+     * @brief Run a system, creating the view first for a ViewSystem
+     */
+    template<System T>
+    ASTRA_FORCEINLINE void InvokeSystem(T& system, Registry& registry)
+    {
+        if constexpr (ViewSystem<T>)
+        {
+            auto view = Detail::SystemViewFactory<SystemViewType<T>>::Create(registry);
+            system(registry, view);
+        }
+        else if constexpr (ChunkSystem<T>)
+        {
+            Detail::SystemViewFactory<ChunkSystemViewType<T>>::Create(registry).ForEachChunk(system);
+        }
+        else
+        {
+            system(registry);
+        }
+    }
+    
+    /**
+     * @brief Helper template to define component and resource access patterns for systems
      * 
-     * Systems can optionally inherit from this to declare their component dependencies.
+     * Systems can optionally inherit from this to declare their dependencies.
      * This allows the scheduler to automatically determine parallelization opportunities.
+     * Traits may be listed in any order and combination.
      * 
      * Example:
      * @code
      * struct PhysicsSystem : SystemTraits<
      *     Reads<Velocity>,
-     *     Writes<Position>
+     *     Writes<Position>,
+     *     ReadsResources<Time>
      * > {
      *     void operator()(Registry& registry) {
      *         // Implementation
@@ -52,33 +171,107 @@ namespace Astra
     template<typename... Components>
     struct Writes { using type = std::tuple<Components...>; };
     
-    template<typename... Traits>
-    struct SystemTraits {};
+    template<typename... Resources>
+    struct ReadsResources { using type = std::tuple<Resources...>; };
     
-    // Specialization for systems with reads and writes
-    template<typename... ReadComponents, typename... WriteComponents>
-    struct SystemTraits<Reads<ReadComponents...>, Writes<WriteComponents...>>
-    {
-        using ReadsComponents = std::tuple<ReadComponents...>;
-        using WritesComponents = std::tuple<WriteComponents...>;
-        static constexpr bool has_traits = true;
-    };
+    template<typename... Resources>
+    struct WritesResources { using type = std::tuple<Resources...>; };
     
-    // Specialization for systems with only reads
-    template<typename... ReadComponents>
-    struct SystemTraits<Reads<ReadComponents...>>
+    namespace Detail
     {
-        using ReadsComponents = std::tuple<ReadComponents...>;
-        using WritesComponents = std::tuple<>;
-        static constexpr bool has_traits = true;
-    };
+        // Splits one access trait into the four access lists
+        template<typename Trait>
+        struct SystemTraitAccess
+        {
+            static_assert(sizeof(Trait) == 0, "SystemTraits accepts Reads, Writes, ReadsResources and WritesResources");
+        };
+        
+        template<typename... Ts>
+        struct SystemTraitAccess<Reads<Ts...>>
+        {
+            using ComponentReads = std::tuple<Ts...>;
+            using ComponentWrites = std::tuple<>;
+            using ResourceReads = std::tuple<>;
+            using ResourceWrites = std::tuple<>;
+        };
+        
+        template<typename... Ts>
+        struct SystemTraitAccess<Writes<Ts...>>
+        {
+            using ComponentReads = std::tuple<>;
+            using ComponentWrites = std::tuple<Ts...>;
+            using ResourceReads = std::tuple<>;
+            using ResourceWrites = std::tuple<>;
+        };
+        
+        template<typename... Ts>
+        struct SystemTraitAccess<ReadsResources<Ts...>>
+        {
+            using ComponentReads = std::tuple<>;
+            using ComponentWrites = std::tuple<>;
+            using ResourceReads = std::tuple<Ts...>;
+            using ResourceWrites = std::tuple<>;
+        };
+        
+        template<typename... Ts>
+        struct SystemTraitAccess<WritesResources<Ts...>>
+        {
+            using ComponentReads = std::tuple<>;
+            using ComponentWrites = std::tuple<>;
+            using ResourceReads = std::tuple<>;
+            using ResourceWrites = std::tuple<Ts...>;
+        };
+        
+        template<typename... Tuples>
+        using TupleCat = decltype(std::tuple_cat(std::declval<Tuples>()...));
+        
+        // Component access of one query argument: const T reads, T writes, Not<T> touches nothing
+        template<typename Arg>
+        struct QueryArgAccess
+        {
+            using Reads = std::conditional_t<std::is_const_v<Arg>, std::tuple<std::remove_const_t<Arg>>, std::tuple<>>;
+            using Writes = std::conditional_t<std::is_const_v<Arg>, std::tuple<>, std::tuple<Arg>>;
+        };
+        
+        template<typename T>
+        struct QueryArgAccess<Optional<T>> : QueryArgAccess<T> {};
+        
+        template<typename T>
+        struct QueryArgAccess<Not<T>>
+        {
+            using Reads = std::tuple<>;
+            using Writes = std::tuple<>;
+        };
+        
+        template<typename... Ts>
+        struct QueryArgAccess<Any<Ts...>>
+        {
+            using Reads = TupleCat<typename QueryArgAccess<Ts>::Reads...>;
+            using Writes = TupleCat<typename QueryArgAccess<Ts>::Writes...>;
+        };
+        
+        template<typename... Ts>
+        struct QueryArgAccess<OneOf<Ts...>> : QueryArgAccess<Any<Ts...>> {};
+        
+        template<typename ViewType>
+        struct ViewAccess;
+        
+        template<typename... QueryArgs>
+        struct ViewAccess<View<QueryArgs...>>
+        {
+            using ReadsComponents = TupleCat<typename QueryArgAccess<QueryArgs>::Reads...>;
+            using WritesComponents = TupleCat<typename QueryArgAccess<QueryArgs>::Writes...>;
+            using Query = QueryBuilder<QueryArgs...>;  // Same cached query the view uses
+        };
+    }
     
-    // Specialization for systems with only writes
-    template<typename... WriteComponents>
-    struct SystemTraits<Writes<WriteComponents...>>
+    template<typename... Traits>
+    struct SystemTraits
     {
-        using ReadsComponents = std::tuple<>;
-        using WritesComponents = std::tuple<WriteComponents...>;
+        using ReadsComponents = Detail::TupleCat<typename Detail::SystemTraitAccess<Traits>::ComponentReads...>;
+        using WritesComponents = Detail::TupleCat<typename Detail::SystemTraitAccess<Traits>::ComponentWrites...>;
+        using ReadsResourceTypes = Detail::TupleCat<typename Detail::SystemTraitAccess<Traits>::ResourceReads...>;
+        using WritesResourceTypes = Detail::TupleCat<typename Detail::SystemTraitAccess<Traits>::ResourceWrites...>;
         static constexpr bool has_traits = true;
     };
     
@@ -93,6 +286,17 @@ namespace Astra
     template<typename T>
     inline constexpr bool HasSystemTraits_v = HasSystemTraits<T>::value;
     
+    // Type trait to detect a system declaring the view it iterates: using Query = View<...>
+    template<typename T>
+    struct HasSystemQuery : std::false_type {};
+    
+    template<typename T>
+    requires requires { typename T::Query; } && Detail::IsView<typename T::Query>::value
+    struct HasSystemQuery<T> : std::true_type {};
+    
+    template<typename T>
+    inline constexpr bool HasSystemQuery_v = HasSystemQuery<T>::value;
+    
     /**
      * @brief Wrapper for lambda-based systems with automatic trait deduction
      * 
@@ -127,6 +331,16 @@ namespace Astra
         
         using ComponentArgs = typename SkipFirst<Args...>::Components;
         
+        // View over the components, const-ness preserved
+        template<typename Tuple>
+        struct ViewOf;
+        
+        template<typename... Components>
+        struct ViewOf<std::tuple<Components...>>
+        {
+            using type = View<std::conditional_t<IsReadOnly<Components>, const BaseType<Components>, BaseType<Components>>...>;
+        };
+        
         // Extract read components (const parameters)
         template<typename Tuple, size_t... Is>
         static auto ExtractReads(std::index_sequence<Is...>)
@@ -162,6 +376,7 @@ namespace Astra
         // Expose deduced traits
         using ReadsComponents = decltype(ExtractReads<ComponentArgs>(MakeIndexSeq()));
         using WritesComponents = decltype(ExtractWrites<ComponentArgs>(MakeIndexSeq()));
+        using Query = typename ViewOf<ComponentArgs>::type;
         static constexpr bool has_traits = true;
         
         explicit LambdaSystemWrapper(Lambda lambda) : m_lambda(std::move(lambda)) {}
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <memory>
 #include <vector>
 
+#include "../Archetype/Archetype.hpp"
+#include "../Core/JobSystem.hpp"
 #include "SystemMetadata.hpp"
 
 namespace Astra
@@ -131,4 +136,262 @@ namespace Astra
         }
     };
     
+    /**
+     * @brief Parallel executor running on a persistent JobSystem
+     * 
+     * Follows the context's dependency graph instead of its groups: each system is queued as
+     * soon as the systems it depends on have finished, so there are no barriers between groups.
+     * Of the systems that become ready together, the one heading the longest dependency chain
+     * runs next on the worker that released it. Systems run as jobs on the pool's workers, and
+     * views the systems iterate in parallel share the same workers when the registry has the
+     * pool attached.
+     * 
+     * Chunk-local systems (see ChunkSystem) run as one job per chunk, and a chunk-local system
+     * that depends on another one starts on a chunk as soon as the other has finished that chunk,
+     * usually on the same worker while the chunk is still in cache. A chunk-local system that
+     * depends on an ordinary one runs as a single job, since its predecessor may add or remove chunks.
+     * 
+     * Contexts without a dependency graph are run group by group.
+     * 
+     * @code
+     * auto jobs = std::make_shared<JobSystem>();
+     * registry.SetJobSystem(jobs);
+     * JobSystemExecutor executor(*jobs);
+     * scheduler.Execute(registry, &executor);
+     * @endcode
+     */
+    class JobSystemExecutor : public ISystemExecutor
+    {
+    public:
+        explicit JobSystemExecutor(JobSystem& jobSystem) :
+            m_jobSystem(jobSystem)
+        {}
+        
+        void Execute(const SystemExecutionContext& context) override
+        {
+            const SystemDependencyGraph& graph = context.dependencyGraph;
+            const size_t count = context.systems.size();
+            if (count == 0)
+                return;
+            
+            if (graph.Size() != count)
+            {
+                ExecuteGroups(context);
+                return;
+            }
+            
+            Pipeline pipeline(context);
+            if (pipeline.jobCount == 0)
+                return;
+            
+            // Lowest priority first, workers pick their newest job first
+            std::vector<size_t> roots = pipeline.TakeRoots();
+            
+            m_jobSystem.ParallelSpawn(pipeline.jobCount, roots, [&pipeline](size_t node, auto& spawn)
+            {
+                pipeline.Run(node);
+                pipeline.Complete(node, spawn);
+            });
+        }
+    
+    private:
+        /**
+         * Nodes of one execution: a node per system, and a node per shared chunk for chunk-local
+         * systems. Between two chunk-local systems the dependency is kept per chunk, so the
+         * successor's work on a chunk starts once the predecessor finished that chunk. Any other
+         * dependency on a chunk-local system waits for all of its chunks.
+         * 
+         * Nodes of a chunk-local system for chunks its query does not match do no work; they are
+         * completed inline when released, so chains through them keep their order.
+         * 
+         * The chunk list is taken before the frame starts, so only systems whose predecessors are
+         * all split are split themselves: nothing ahead of them can change the chunks.
+         */
+        struct Pipeline
+        {
+            const SystemExecutionContext& context;
+            const SystemDependencyGraph& graph;
+            size_t chunkCount;
+            std::vector<size_t> firstNode;      // First node of each system, plus the total at the end
+            std::vector<size_t> nodeSystem;     // System of each node
+            std::vector<bool> emptyNode;        // Chunk nodes without work
+            std::vector<bool> split;            // Systems run as a node per chunk
+            std::unique_ptr<std::atomic<size_t>[]> pending;
+            size_t jobCount = 0;
+            
+            explicit Pipeline(const SystemExecutionContext& ctx) :
+                context(ctx),
+                graph(ctx.dependencyGraph),
+                chunkCount(ctx.chunks.size())
+            {
+                const size_t count = context.systems.size();
+                split.resize(count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    split[i] = chunkCount > 0 && context.metadata[i].chunkLocal && context.chunkSystems[i];
+                }
+                
+                // Visit systems after all their predecessors, an unsplit one unsplits its successors
+                std::vector<size_t> waiting = graph.predecessorCounts;
+                std::vector<size_t> ready = graph.roots;
+                while (!ready.empty())
+                {
+                    const size_t system = ready.back();
+                    ready.pop_back();
+                    for (size_t successor : graph.successors[system])
+                    {
+                        if (!split[system])
+                            split[successor] = false;
+                        if (--waiting[successor] == 0)
+                            ready.push_back(successor);
+                    }
+                }
+                
+                firstNode.resize(count + 1, 0);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    firstNode[i + 1] = firstNode[i] + (IsSplit(i) ? chunkCount : 1);
+                }
+                
+                const size_t nodeCount = firstNode[count];
+                nodeSystem.resize(nodeCount);
+                emptyNode.assign(nodeCount, false);
+                std::vector<size_t> predecessors(nodeCount, 0);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    for (size_t node = firstNode[i]; node < firstNode[i + 1]; ++node)
+                    {
+                        nodeSystem[node] = i;
+                        if (IsSplit(i))
+                        {
+                            const SystemChunk& chunk = context.chunks[node - firstNode[i]];
+                            emptyNode[node] = !context.metadata[i].queryMatcher(chunk.archetype->GetMask());
+                        }
+                        jobCount += emptyNode[node] ? 0 : 1;
+                        
+                        ForEachSuccessor(node, [&predecessors](size_t successor) { ++predecessors[successor]; });
+                    }
+                }
+                
+                pending.reset(new std::atomic<size_t>[nodeCount]);
+                for (size_t node = 0; node < nodeCount; ++node)
+                {
+                    pending[node].store(predecessors[node], std::memory_order_relaxed);
+                }
+            }
+            
+            ASTRA_NODISCARD bool IsSplit(size_t system) const noexcept
+            {
+                return split[system];
+            }
+            
+            template<typename Func>
+            void ForEachSuccessor(size_t node, Func&& func) const
+            {
+                const size_t system = nodeSystem[node];
+                const bool split = IsSplit(system);
+                const size_t chunk = node - firstNode[system];
+                
+                // Successors are ordered shortest critical path first, so the longest is released last
+                for (size_t successor : graph.successors[system])
+                {
+                    if (!IsSplit(successor))
+                    {
+                        func(firstNode[successor]);
+                    }
+                    else if (split)
+                    {
+                        func(firstNode[successor] + chunk);
+                    }
+                    else
+                    {
+                        for (size_t c = 0; c < chunkCount; ++c)
+                        {
+                            func(firstNode[successor] + c);
+                        }
+                    }
+                }
+            }
+            
+            void Run(size_t node) const
+            {
+                const size_t system = nodeSystem[node];
+                if (IsSplit(system))
+                {
+                    const SystemChunk& chunk = context.chunks[node - firstNode[system]];
+                    context.chunkSystems[system](chunk.archetype, chunk.chunkIndex);
+                }
+                else
+                {
+                    context.systems[system](*context.registry);
+                }
+            }
+            
+            // Release the successors of a finished node, emitting those that are ready to run
+            template<typename Emit>
+            void Complete(size_t node, Emit& emit)
+            {
+                std::vector<size_t> empty;
+                auto release = [this, &emit, &empty](size_t successor)
+                {
+                    if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                        return;
+                    
+                    if (emptyNode[successor])
+                        empty.push_back(successor);
+                    else
+                        emit(successor);
+                };
+                
+                ForEachSuccessor(node, release);
+                while (!empty.empty())
+                {
+                    const size_t next = empty.back();
+                    empty.pop_back();
+                    ForEachSuccessor(next, release);
+                }
+            }
+            
+            // Nodes without predecessors, empty ones completed, lowest critical path first
+            std::vector<size_t> TakeRoots()
+            {
+                std::vector<size_t> initial;
+                for (size_t node = 0; node < nodeSystem.size(); ++node)
+                {
+                    if (pending[node].load(std::memory_order_relaxed) == 0)
+                        initial.push_back(node);
+                }
+                
+                std::vector<size_t> roots;
+                auto emit = [&roots](size_t node) { roots.push_back(node); };
+                for (size_t node : initial)
+                {
+                    if (emptyNode[node])
+                        Complete(node, emit);
+                    else
+                        roots.push_back(node);
+                }
+                
+                std::stable_sort(roots.begin(), roots.end(), [this](size_t a, size_t b)
+                {
+                    return graph.criticalPath[nodeSystem[a]] < graph.criticalPath[nodeSystem[b]];
+                });
+                return roots;
+            }
+        };
+        
+        void ExecuteGroups(const SystemExecutionContext& context)
+        {
+            for (const auto& group : context.parallelGroups)
+            {
+                m_jobSystem.ParallelFor(group.size(), [&context, &group](size_t i)
+                {
+                    context.systems[group[i]](*context.registry);
+                });
+            }
+        }
+        
+        JobSystem& m_jobSystem;
+    };
+    
 } // namespace Astra
\ No newline at end of file
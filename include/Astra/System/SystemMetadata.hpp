@@ -8,14 +8,16 @@
 #include "../Core/Base.hpp"
 #include "../Core/Delegate.hpp"
 #include "../Core/TypeID.hpp"
+#include "../Registry/ResourceStorage.hpp"
 
 namespace Astra
 {
     // Forward declarations
+    class Archetype;
     class Registry;
     
     /**
-     * @brief Metadata describing a system's component access patterns and scheduling hints
+     * @brief Metadata describing a system's component and resource access patterns and scheduling hints
      * 
      * This information is used for:
      * - Identifying safe parallelization opportunities
@@ -30,11 +32,71 @@ namespace Astra
         // Components this system writes (mutable access)
         ComponentMask writes;
         
+        // Registry resources this system reads and writes
+        ResourceMask resourceReads{};
+        ResourceMask resourceWrites{};
+        
         // Runtime type identifier for the system (type-erased)
         size_t typeId;
         
         // Insertion order (for stable sorting and debugging)
         size_t insertionOrder;
+        
+        // Cached archetype query of the view the system iterates, null when unknown
+        // Systems whose archetypes never overlap may write the same components in parallel
+        bool (*queryMatcher)(const ComponentMask&) = nullptr;
+        ComponentMask queryRequired{};
+        
+        // Components the query itself reads or writes, access beyond them may reach any entity
+        ComponentMask queryAccess{};
+        
+        // Chunk-local system, its work can be split and ordered per chunk (see ChunkSystem)
+        bool chunkLocal = false;
+    };
+    
+    /**
+     * @brief One chunk of an archetype, the unit of work of chunk-local systems
+     */
+    struct SystemChunk
+    {
+        Archetype* archetype;
+        size_t chunkIndex;
+    };
+    
+    /**
+     * @brief Dependency graph between systems, built from their access masks
+     * 
+     * System j depends on every earlier system i whose access conflicts with it, so running each
+     * system once its predecessors have finished gives the same result as registration order.
+     * Edges always point from a lower to a higher index, so index order is a topological order.
+     * 
+     * Unlike parallelGroups there are no barriers: a slow system only delays the systems that
+     * actually depend on it.
+     */
+    struct SystemDependencyGraph
+    {
+        /**
+         * Systems that must wait for system i, shortest critical path first
+         */
+        std::vector<std::vector<size_t>> successors;
+        
+        /**
+         * Number of systems system i waits for
+         */
+        std::vector<size_t> predecessorCounts;
+        
+        /**
+         * Length of the longest dependency chain starting at system i, counting i itself.
+         * Executors run ready systems with the longest chain first to shorten the frame.
+         */
+        std::vector<size_t> criticalPath;
+        
+        /**
+         * Systems without predecessors, longest critical path first
+         */
+        std::vector<size_t> roots;
+        
+        ASTRA_NODISCARD size_t Size() const noexcept { return successors.size(); }
     };
     
     /**
@@ -59,6 +121,12 @@ namespace Astra
          */
         std::vector<std::vector<size_t>> parallelGroups;
         
+        /**
+         * Dependency graph over the same systems, for executors that start each system as soon
+         * as its predecessors finish instead of running group by group
+         */
+        SystemDependencyGraph dependencyGraph;
+        
         /**
          * The actual system execution functions.
          * Using Delegate for better performance than std::function.
@@ -66,6 +134,25 @@ namespace Astra
          */
         std::vector<Delegate<void(Registry&)>> systems;
         
+        /**
+         * Per-chunk entry points of chunk-local systems, empty delegates for other systems.
+         * Running one on every chunk its query matches does the same work as systems[i].
+         */
+        std::vector<Delegate<void(Archetype*, size_t)>> chunkSystems;
+        
+        /**
+         * Non-empty chunks of every archetype a chunk-local system matches, taken when
+         * execution starts. Empty when no chunk-local system is registered.
+         */
+        std::vector<SystemChunk> chunks;
+        
+        /**
+         * Registered systems each index runs, in order. A single system unless consecutive
+         * chunk-local systems were fused into one pass per chunk; metadata then holds their
+         * combined access.
+         */
+        std::vector<std::vector<size_t>> fusedSystems;
+        
         /**
          * Metadata for each system (optional, for debugging/profiling)
          * Indexed by system index (matches parallelGroups indices)
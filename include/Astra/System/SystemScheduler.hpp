@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -75,6 +77,7 @@ namespace Astra
         {
             std::unique_ptr<void, void(*)(void*)> instance;  // Type-erased system instance
             Delegate<void(Registry&)> execute;               // Execution delegate (more efficient than std::function)
+            Delegate<void(Archetype*, size_t)> executeChunk; // Per-chunk delegate of chunk-local systems
             SystemMetadata metadata;                         // System metadata
         };
     public:
@@ -86,6 +89,8 @@ namespace Astra
          * 
          * For functor systems:
          * - If the system inherits from SystemTraits, dependencies are auto-detected
+         * - If it declares using Query = View<...>, or takes (Registry&, View<...>&), they are
+         *   deduced from the view: const components are read, the others written
          * - Otherwise, the system runs sequentially (safe default)
          * 
          * @note Systems are stored by value within the scheduler. If your system
@@ -122,17 +127,9 @@ namespace Astra
                 .insertionOrder = index
             };
             
-            // Auto-detect component dependencies if the system has traits
-            if constexpr (HasSystemTraits_v<T>)
-            {
-                ExtractSystemTraits<T>(metadata);
-            }
-            else
-            {
-                // No traits = conservative approach: assume system touches everything
-                // This forces sequential execution for safety
-                // Leave reads and writes empty - this triggers conservative scheduling
-            }
+            // Auto-detect component dependencies from traits, a declared query or the injected view
+            // Without any of them reads and writes stay empty, which triggers conservative scheduling
+            ExtractSystemAccess<T>(metadata);
             
             // Create entry with type erasure
             m_systems.emplace_back(SystemEntry{
@@ -140,7 +137,8 @@ namespace Astra
                     instance,
                     [](void* ptr) { delete static_cast<T*>(ptr); }
                 ),
-                .execute = [instance](Registry& reg) { (*instance)(reg); },
+                .execute = [instance](Registry& reg) { InvokeSystem(*instance, reg); },
+                .executeChunk = MakeChunkDelegate(instance),
                 .metadata = metadata
             });
             
@@ -150,8 +148,9 @@ namespace Astra
         /**
          * Add a lambda system with automatic trait deduction
          * 
-         * This overload handles lambdas with signature (Entity, Components...).
-         * Component access patterns are automatically deduced from const-ness.
+         * This overload handles lambdas with signature (Entity, Components...) or
+         * (Registry&, View<...>&). Component access patterns are automatically deduced
+         * from const-ness; the view of the second form is created for each run.
          * 
          * @tparam Lambda Lambda type
          * @param lambda Lambda function to use as system
@@ -160,10 +159,18 @@ namespace Astra
         requires LambdaLike<Lambda>
         void AddSystem(Lambda&& lambda)
         {
-            AddLambdaSystemImpl(
-                std::forward<Lambda>(lambda),
-                &std::decay_t<Lambda>::operator()
-            );
+            if constexpr (ViewSystem<std::decay_t<Lambda>> || ChunkSystem<std::decay_t<Lambda>>)
+            {
+                // (Registry&, View<...>&) or (ChunkView<...>): the view's arguments give the access
+                AddSystemInternal<std::decay_t<Lambda>>(std::forward<Lambda>(lambda));
+            }
+            else
+            {
+                AddLambdaSystemImpl(
+                    std::forward<Lambda>(lambda),
+                    &std::decay_t<Lambda>::operator()
+                );
+            }
         }
         
     private:
@@ -211,10 +218,7 @@ namespace Astra
             };
             
             // Auto-detect component dependencies
-            if constexpr (HasSystemTraits_v<SystemType>)
-            {
-                ExtractSystemTraits<SystemType>(metadata);
-            }
+            ExtractSystemAccess<SystemType>(metadata);
             
             // Create entry with type erasure
             m_systems.emplace_back(SystemEntry{
@@ -222,7 +226,8 @@ namespace Astra
                     instance,
                     [](void* ptr) { delete static_cast<SystemType*>(ptr); }
                 ),
-                .execute = [instance](Registry& reg) { (*instance)(reg); },
+                .execute = [instance](Registry& reg) { InvokeSystem(*instance, reg); },
+                .executeChunk = MakeChunkDelegate(instance),
                 .metadata = metadata
             });
             
@@ -298,26 +303,61 @@ namespace Astra
             if (m_systems.empty())
                 return;
             
-            if (m_needsRebuild)
-            {
-                BuildExecutionPlan();
-            }
+            ArchetypeManager& archetypes = registry.GetArchetypeManager();
+            EnsureExecutionPlan(&archetypes);
             
-            // Build execution context
-            SystemExecutionContext context;
-            context.registry = &registry;
-            context.parallelGroups = m_executionPlan;
-            context.systems.reserve(m_systems.size());
-            context.metadata.reserve(m_systems.size());
+            // The context is built with the plan, only the chunk list changes from frame to frame
+            m_context.registry = &registry;
+            CollectChunks(m_context.chunks);
+            
+            // Execute via the provided executor
+            executor->Execute(m_context);
             
-            for (const auto& entry : m_systems)
+            if (m_validateArchetypeAccess)
             {
-                context.systems.push_back(entry.execute);
-                context.metadata.push_back(entry.metadata);
+                ValidateArchetypeAccess(archetypes);
             }
-            
-            // Execute via the provided executor
-            executor->Execute(context);
+        }
+        
+        /**
+         * Re-check after every Execute that systems scheduled in parallel because their
+         * archetypes were disjoint still are, including archetypes created during the frame
+         * 
+         * Violations are recorded in GetArchetypeAccessViolations, assert it is empty after a
+         * frame. Meant for debugging, it costs one archetype comparison per relaxed pair and frame.
+         */
+        void SetArchetypeAccessValidation(bool enabled) noexcept
+        {
+            m_validateArchetypeAccess = enabled;
+        }
+        
+        /**
+         * Pairs of plan indices whose archetypes overlapped after the last validated Execute
+         */
+        ASTRA_NODISCARD const std::vector<std::pair<size_t, size_t>>& GetArchetypeAccessViolations() const noexcept
+        {
+            return m_archetypeAccessViolations;
+        }
+        
+        /**
+         * Fuse consecutive chunk-local systems over the same archetypes into one pass per chunk
+         * 
+         * Enabled by default. Disable it to see and profile every system on its own.
+         */
+        void SetSystemFusion(bool enabled) noexcept
+        {
+            m_fuseSystems = enabled;
+            m_needsRebuild = true;
+        }
+        
+        /**
+         * Get the registered systems behind each index of the plan and graph last built
+         * 
+         * One system per index, except consecutive chunk-local systems fused into one pass.
+         */
+        ASTRA_NODISCARD const std::vector<std::vector<size_t>>& GetExecutionUnits() const noexcept
+        {
+            return m_units;
         }
         
         /**
@@ -328,6 +368,13 @@ namespace Astra
             m_systems.clear();
             m_systemIndices.Clear();
             m_executionPlan.clear();
+            m_dependencyGraph = SystemDependencyGraph{};
+            m_units.clear();
+            m_unitMetadata.clear();
+            m_disjointPairs.clear();
+            m_archetypeAccessViolations.clear();
+            m_chunkArchetypes.clear();
+            m_context = SystemExecutionContext{};
             m_needsRebuild = true;
         }
         
@@ -352,19 +399,120 @@ namespace Astra
          * 
          * Returns the parallel groups that will be executed.
          * Each inner vector contains system indices that can run in parallel.
+         * Without a registry conflicts are judged per component only; pass the registry to
+         * get the plan Execute uses, which also looks at the archetypes each query matches
+         * and may fuse systems, see GetExecutionUnits.
          * 
          * @return Vector of parallel groups
          */
         ASTRA_NODISCARD const std::vector<std::vector<size_t>>& GetExecutionPlan() const
         {
-            if (m_needsRebuild)
-            {
-                const_cast<SystemScheduler*>(this)->BuildExecutionPlan();
-            }
+            const_cast<SystemScheduler*>(this)->EnsureExecutionPlan(nullptr);
             return m_executionPlan;
         }
         
+        ASTRA_NODISCARD const std::vector<std::vector<size_t>>& GetExecutionPlan(Registry& registry)
+        {
+            EnsureExecutionPlan(&registry.GetArchetypeManager());
+            return m_executionPlan;
+        }
+        
+        /**
+         * Get the dependency graph for debugging/visualization
+         * 
+         * Built together with the execution plan; successors hold only the direct
+         * dependencies, edges implied by a longer chain are left out.
+         */
+        ASTRA_NODISCARD const SystemDependencyGraph& GetDependencyGraph() const
+        {
+            const_cast<SystemScheduler*>(this)->EnsureExecutionPlan(nullptr);
+            return m_dependencyGraph;
+        }
+        
+        ASTRA_NODISCARD const SystemDependencyGraph& GetDependencyGraph(Registry& registry)
+        {
+            EnsureExecutionPlan(&registry.GetArchetypeManager());
+            return m_dependencyGraph;
+        }
+        
     private:
+        /**
+         * Extract component dependencies from a system
+         * 
+         * Explicit traits win; otherwise a declared Query view or the view a ViewSystem receives
+         * gives the access, const components read and the others written. Systems with none of
+         * these are left without hints and scheduled conservatively.
+         */
+        template<typename T>
+        void ExtractSystemAccess(SystemMetadata& metadata)
+        {
+            if constexpr (HasSystemTraits_v<T>)
+            {
+                ExtractSystemTraits<T>(metadata);
+            }
+            else if constexpr (HasSystemQuery_v<T>)
+            {
+                ExtractViewAccess<typename T::Query>(metadata);
+            }
+            else if constexpr (ViewSystem<T>)
+            {
+                ExtractViewAccess<SystemViewType<T>>(metadata);
+            }
+            else if constexpr (ChunkSystem<T>)
+            {
+                ExtractViewAccess<ChunkSystemViewType<T>>(metadata);
+            }
+            
+            // The archetypes a known view matches refine conflicts, traits alone do not name any
+            if constexpr (HasSystemQuery_v<T>)
+            {
+                ExtractViewQuery<typename T::Query>(metadata);
+            }
+            else if constexpr (ViewSystem<T>)
+            {
+                ExtractViewQuery<SystemViewType<T>>(metadata);
+            }
+            else if constexpr (ChunkSystem<T>)
+            {
+                ExtractViewQuery<ChunkSystemViewType<T>>(metadata);
+                metadata.chunkLocal = true;
+            }
+        }
+        
+        template<typename T>
+        static Delegate<void(Archetype*, size_t)> MakeChunkDelegate(T* instance)
+        {
+            if constexpr (ChunkSystem<T>)
+            {
+                return [instance](Archetype* archetype, size_t chunkIndex)
+                {
+                    (*instance)(ChunkSystemViewType<T>::GetChunkView(archetype, chunkIndex));
+                };
+            }
+            else
+            {
+                (void)instance;
+                return {};
+            }
+        }
+        
+        template<typename ViewType>
+        void ExtractViewQuery(SystemMetadata& metadata)
+        {
+            using Query = typename Detail::ViewAccess<ViewType>::Query;
+            metadata.queryMatcher = &Query::Matches;
+            metadata.queryRequired = Query::GetRequiredMask();
+            ExtractComponentMask<typename Detail::ViewAccess<ViewType>::ReadsComponents>(metadata.queryAccess);
+            ExtractComponentMask<typename Detail::ViewAccess<ViewType>::WritesComponents>(metadata.queryAccess);
+        }
+        
+        template<typename ViewType>
+        void ExtractViewAccess(SystemMetadata& metadata)
+        {
+            ExtractComponentMask<typename Detail::ViewAccess<ViewType>::ReadsComponents>(metadata.reads);
+            ExtractComponentMask<typename Detail::ViewAccess<ViewType>::WritesComponents>(metadata.writes);
+        }
+        
         /**
          * Extract component dependencies from a system with traits
          */
@@ -378,9 +526,22 @@ namespace Astra
                 
                 // Extract write components
                 ExtractComponentMask<typename T::WritesComponents>(metadata.writes);
+                
+                // Resource access is optional, lambda systems only deduce components
+                if constexpr (requires { typename T::ReadsResourceTypes; typename T::WritesResourceTypes; })
+                {
+                    ExtractResourceMask(metadata.resourceReads, static_cast<typename T::ReadsResourceTypes*>(nullptr));
+                    ExtractResourceMask(metadata.resourceWrites, static_cast<typename T::WritesResourceTypes*>(nullptr));
+                }
             }
         }
         
+        template<typename... Resources>
+        static void ExtractResourceMask(ResourceMask& mask, std::tuple<Resources...>*)
+        {
+            mask |= MakeResourceMask<Resources...>();
+        }
+        
         /**
          * Helper to convert a tuple of component types to a ComponentMask
          */
@@ -396,6 +557,291 @@ namespace Astra
             ((mask |= MakeComponentMask<std::tuple_element_t<Is, Tuple>>()), ...);
         }
         
+        /**
+         * Rebuild the plan when systems changed, or when it was built for other archetypes
+         * 
+         * Keyed on the structural change counter rather than the generation: the counter also
+         * moves when Defragment destroys empty archetypes, which the cached archetype lists
+         * would otherwise keep pointing at.
+         */
+        void EnsureExecutionPlan(ArchetypeManager* archetypes)
+        {
+            if (!m_needsRebuild && archetypes == m_plannedArchetypes &&
+                (!archetypes || archetypes->GetStructuralChangeCounter() == m_plannedStructuralChange))
+                return;
+            
+            m_plannedArchetypes = archetypes;
+            m_plannedGeneration = archetypes ? archetypes->GetCurrentGeneration() : 0;
+            m_plannedStructuralChange = archetypes ? archetypes->GetStructuralChangeCounter() : 0;
+            CollectSystemArchetypes(archetypes);
+            BuildExecutionUnits();
+            CollectDisjointPairs();
+            BuildExecutionPlan();
+            BuildExecutionContext();
+        }
+        
+        // Everything Execute hands the executor except the registry and chunks, which change per frame
+        void BuildExecutionContext()
+        {
+            m_context.parallelGroups = m_executionPlan;
+            m_context.dependencyGraph = m_dependencyGraph;
+            m_context.metadata = m_unitMetadata;
+            m_context.fusedSystems = m_units;
+            m_context.systems.clear();
+            m_context.chunkSystems.clear();
+            m_context.systems.reserve(m_units.size());
+            m_context.chunkSystems.reserve(m_units.size());
+            
+            for (const auto& unit : m_units)
+            {
+                if (unit.size() == 1)
+                {
+                    m_context.systems.push_back(m_systems[unit[0]].execute);
+                    m_context.chunkSystems.push_back(m_systems[unit[0]].executeChunk);
+                }
+                else
+                {
+                    AddFusedUnit(m_context, unit);
+                }
+            }
+            
+            m_chunkArchetypes.clear();
+            for (size_t i = 0; i < m_systems.size(); ++i)
+            {
+                if (m_systems[i].metadata.chunkLocal)
+                {
+                    m_chunkArchetypes.insert(m_chunkArchetypes.end(), m_systemArchetypes[i].begin(), m_systemArchetypes[i].end());
+                }
+            }
+            std::sort(m_chunkArchetypes.begin(), m_chunkArchetypes.end());
+            m_chunkArchetypes.erase(std::unique(m_chunkArchetypes.begin(), m_chunkArchetypes.end()), m_chunkArchetypes.end());
+        }
+        
+        // Sorted archetypes of every system with a known query, empty lists for the others
+        void CollectSystemArchetypes(ArchetypeManager* archetypes)
+        {
+            m_systemArchetypes.assign(m_systems.size(), {});
+            m_hasSystemArchetypes.assign(m_systems.size(), false);
+            if (!archetypes)
+                return;
+            
+            for (size_t i = 0; i < m_systems.size(); ++i)
+            {
+                const SystemMetadata& system = m_systems[i].metadata;
+                if (!system.queryMatcher)
+                    continue;
+                
+                const auto& matched = archetypes->GetQueryArchetypes(system.queryMatcher, system.queryRequired);
+                m_systemArchetypes[i].assign(matched.begin(), matched.end());
+                std::sort(m_systemArchetypes[i].begin(), m_systemArchetypes[i].end());
+                m_hasSystemArchetypes[i] = true;
+            }
+        }
+        
+        /**
+         * Group the systems into the units the plan schedules
+         * 
+         * Consecutive chunk-local systems matching the same non-empty archetype set are fused
+         * into one unit that calls every body per chunk in registration order, so each chunk
+         * is streamed through cache once. Each system only touches its own rows, so the result
+         * matches running them one after the other. Every other system is a unit of its own.
+         * A unit's access is the union of its systems' access.
+         */
+        void BuildExecutionUnits()
+        {
+            m_units.clear();
+            m_unitMetadata.clear();
+            for (size_t i = 0; i < m_systems.size(); ++i)
+            {
+                const size_t last = m_units.empty() ? 0 : m_units.back().back();
+                if (m_fuseSystems && !m_units.empty() && CanFuse(last, i))
+                {
+                    const SystemMetadata& system = m_systems[i].metadata;
+                    SystemMetadata& unit = m_unitMetadata.back();
+                    unit.reads |= system.reads;
+                    unit.writes |= system.writes;
+                    unit.queryAccess |= system.queryAccess;
+                    unit.resourceReads |= system.resourceReads;
+                    unit.resourceWrites |= system.resourceWrites;
+                    m_units.back().push_back(i);
+                }
+                else
+                {
+                    m_units.push_back({i});
+                    m_unitMetadata.push_back(m_systems[i].metadata);
+                }
+            }
+        }
+        
+        ASTRA_NODISCARD bool CanFuse(size_t previous, size_t next) const
+        {
+            const SystemMetadata& a = m_systems[previous].metadata;
+            const SystemMetadata& b = m_systems[next].metadata;
+            return a.chunkLocal && b.chunkLocal && HasHints(a) && HasHints(b) &&
+                m_hasSystemArchetypes[previous] && m_hasSystemArchetypes[next] &&
+                !m_systemArchetypes[previous].empty() &&
+                m_systemArchetypes[previous] == m_systemArchetypes[next];
+        }
+        
+        // Conflicting unit pairs that only run in parallel because their archetypes are disjoint
+        void CollectDisjointPairs()
+        {
+            m_disjointPairs.clear();
+            for (size_t b = 0; b < m_unitMetadata.size(); ++b)
+            {
+                for (size_t a = 0; a < b; ++a)
+                {
+                    const auto& unitA = m_unitMetadata[a];
+                    const auto& unitB = m_unitMetadata[b];
+                    if (HasHints(unitA) && HasHints(unitB) && !ResourceConflicts(unitA, unitB) &&
+                        ComponentConflicts(unitA, unitB) && QueriesCoverConflicts(unitA, unitB) &&
+                        ArchetypesDisjoint(a, b))
+                    {
+                        m_disjointPairs.emplace_back(a, b);
+                    }
+                }
+            }
+        }
+        
+        // Systems of a unit share one archetype set, the first one stands for all
+        ASTRA_NODISCARD bool ArchetypesDisjoint(size_t a, size_t b) const
+        {
+            const size_t systemA = m_units[a].front();
+            const size_t systemB = m_units[b].front();
+            if (!m_hasSystemArchetypes[systemA] || !m_hasSystemArchetypes[systemB])
+                return false;
+            
+            // Both lists are sorted by address
+            const auto& listA = m_systemArchetypes[systemA];
+            const auto& listB = m_systemArchetypes[systemB];
+            auto itA = listA.begin();
+            auto itB = listB.begin();
+            while (itA != listA.end() && itB != listB.end())
+            {
+                if (*itA == *itB)
+                    return false;
+                if (std::less<>{}(*itA, *itB))
+                    ++itA;
+                else
+                    ++itB;
+            }
+            return true;
+        }
+        
+        // One pass over the unit's chunks calling every fused system per chunk, in order. The fused systems
+        // matched the same archetypes when the plan was built, but archetypes created during the frame may
+        // match only some of them: the unit walks the union of their archetypes and each body checks its own
+        void AddFusedUnit(SystemExecutionContext& context, const std::vector<size_t>& unit) const
+        {
+            using Matcher = bool (*)(const ComponentMask&);
+            std::vector<std::pair<Delegate<void(Archetype*, size_t)>, Matcher>> bodies;
+            std::vector<std::pair<Matcher, ComponentMask>> queries;
+            bodies.reserve(unit.size());
+            queries.reserve(unit.size());
+            for (size_t system : unit)
+            {
+                const SystemMetadata& metadata = m_systems[system].metadata;
+                bodies.emplace_back(m_systems[system].executeChunk, metadata.queryMatcher);
+                queries.emplace_back(metadata.queryMatcher, metadata.queryRequired);
+            }
+            
+            auto perChunk = [bodies](Archetype* archetype, size_t chunkIndex)
+            {
+                for (const auto& [body, matcher] : bodies)
+                {
+                    if (matcher(archetype->GetMask()))
+                    {
+                        body(archetype, chunkIndex);
+                    }
+                }
+            };
+            
+            context.chunkSystems.push_back(perChunk);
+            // Built once per plan, so the per-frame archetype lists are kept alive between frames
+            struct Scratch
+            {
+                std::vector<Archetype*> archetypes;
+                std::vector<Archetype*> matched;
+            };
+            
+            context.systems.push_back([perChunk, queries, scratch = std::make_shared<Scratch>()](Registry& registry)
+            {
+                // Other units may change the structure meanwhile, so the lists are copied
+                auto& manager = registry.GetArchetypeManager();
+                auto& archetypes = scratch->archetypes;
+                auto& matched = scratch->matched;
+                archetypes.clear();
+                for (const auto& [matcher, required] : queries)
+                {
+                    uint64_t version = 0;
+                    manager.CopyQueryArchetypes(manager.GetQuery(matcher, required), matched, version);
+                    archetypes.insert(archetypes.end(), matched.begin(), matched.end());
+                }
+                std::sort(archetypes.begin(), archetypes.end());
+                archetypes.erase(std::unique(archetypes.begin(), archetypes.end()), archetypes.end());
+                
+                for (Archetype* archetype : archetypes)
+                {
+                    const size_t chunkCount = archetype->GetChunkCount();
+                    for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+                    {
+                        if (archetype->GetChunkEntityCount(chunkIndex) > 0)
+                        {
+                            perChunk(archetype, chunkIndex);
+                        }
+                    }
+                }
+            });
+        }
+        
+        // Non-empty chunks of the archetypes matched by chunk-local systems, each archetype once
+        void CollectChunks(std::vector<SystemChunk>& chunks) const
+        {
+            chunks.clear();
+            for (Archetype* archetype : m_chunkArchetypes)
+            {
+                const size_t chunkCount = archetype->GetChunkCount();
+                for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+                {
+                    if (archetype->GetChunkEntityCount(chunkIndex) > 0)
+                    {
+                        chunks.push_back(SystemChunk{archetype, chunkIndex});
+                    }
+                }
+            }
+        }
+        
+        void ValidateArchetypeAccess(ArchetypeManager& archetypes)
+        {
+            m_archetypeAccessViolations.clear();
+            if (m_disjointPairs.empty() || archetypes.GetCurrentGeneration() == m_plannedGeneration)
+                return;
+            
+            for (const auto& [a, b] : m_disjointPairs)
+            {
+                // Fused systems matched the same archetypes when planned, but new ones may differ
+                bool overlap = false;
+                for (size_t systemA : m_units[a])
+                {
+                    for (size_t systemB : m_units[b])
+                    {
+                        const auto& sysA = m_systems[systemA].metadata;
+                        const auto& sysB = m_systems[systemB].metadata;
+                        const auto& listA = archetypes.GetQueryArchetypes(sysA.queryMatcher, sysA.queryRequired);
+                        const auto& listB = archetypes.GetQueryArchetypes(sysB.queryMatcher, sysB.queryRequired);
+                        overlap = overlap || std::any_of(listA.begin(), listA.end(), [&listB](Archetype* archetype)
+                        {
+                            return std::find(listB.begin(), listB.end(), archetype) != listB.end();
+                        });
+                    }
+                }
+                if (overlap)
+                {
+                    m_archetypeAccessViolations.emplace_back(a, b);
+                }
+            }
+        }
+        
         /**
          * Build the execution plan based on component access patterns
          * 
@@ -407,67 +853,57 @@ namespace Astra
         void BuildExecutionPlan()
         {
             m_executionPlan.clear();
+            BuildDependencyGraph();
             
-            if (m_systems.empty())
+            if (m_unitMetadata.empty())
             {
                 m_needsRebuild = false;
                 return;
             }
             
-            std::vector<bool> scheduled(m_systems.size(), false);
+            std::vector<bool> scheduled(m_unitMetadata.size(), false);
             
             // Process systems in insertion order
-            for (size_t i = 0; i < m_systems.size(); ++i)
+            for (size_t i = 0; i < m_unitMetadata.size(); ++i)
             {
                 if (scheduled[i])
                     continue;
                 
                 // Start new parallel group with this system
                 std::vector<size_t> group;
-                group.reserve(m_systems.size() - i);  // Reserve space for potential members
+                group.reserve(m_unitMetadata.size() - i);  // Reserve space for potential members
                 group.push_back(i);
                 scheduled[i] = true;
                 
                 // Track component usage for the entire group
                 // This allows us to check conflicts with the group as a whole
                 // rather than checking against each system in the group
-                const auto& sysI = m_systems[i].metadata;
-                ComponentMask groupReads = sysI.reads;
-                ComponentMask groupWrites = sysI.writes;
+                const auto& sysI = m_unitMetadata[i];
+                SystemMetadata groupAccess = sysI;
                 
                 // If the first system has no hints, no other system can join this group
                 // This ensures conservative safety
-                const bool groupAcceptsMore = !(sysI.reads.None() && sysI.writes.None());
+                const bool groupAcceptsMore = HasHints(sysI);
                 
                 // Look ahead for systems that can run in parallel
-                for (size_t j = i + 1; j < m_systems.size() && groupAcceptsMore; ++j)
+                for (size_t j = i + 1; j < m_unitMetadata.size() && groupAcceptsMore; ++j)
                 {
                     if (scheduled[j])
                         continue;
                     
-                    const auto& sysJ = m_systems[j].metadata;
+                    const auto& sysJ = m_unitMetadata[j];
                     
-                    // Fast conflict check against group's aggregate component usage
+                    // Fast conflict check against group's aggregate component and resource usage
                     // System j conflicts with the group if:
                     // - It writes to something the group reads or writes
                     // - It reads something the group writes
-                    bool conflictsWithGroup = false;
-                    
-                    // Check if system has no hints (conservative approach)
-                    if (sysJ.reads.None() && sysJ.writes.None())
-                    {
-                        conflictsWithGroup = true;
-                    }
-                    else
-                    {
-                        // Check actual component conflicts using bitmasks
-                        conflictsWithGroup = 
-                            (sysJ.writes & groupWrites).Any() ||  // Write-write conflict
-                            (sysJ.writes & groupReads).Any() ||   // Write-read conflict  
-                            (sysJ.reads & groupWrites).Any();     // Read-write conflict
-                    }
+                    // - It has no hints (conservative approach)
+                    if (!HasHints(sysJ))
+                        continue;
                     
-                    if (conflictsWithGroup)
+                    // An aggregate conflict may still vanish at archetype level, check the members
+                    if (AccessConflicts(sysJ, groupAccess) &&
+                        std::any_of(group.begin(), group.end(), [this, j](size_t member) { return HasConflict(member, j); }))
                         continue;
                     
                     // Check if j depends on any unscheduled system before it
@@ -487,8 +923,10 @@ namespace Astra
                         // Add system to group and update group's component usage
                         group.push_back(j);
                         scheduled[j] = true;
-                        groupReads |= sysJ.reads;
-                        groupWrites |= sysJ.writes;
+                        groupAccess.reads |= sysJ.reads;
+                        groupAccess.writes |= sysJ.writes;
+                        groupAccess.resourceReads |= sysJ.resourceReads;
+                        groupAccess.resourceWrites |= sysJ.resourceWrites;
                     }
                 }
                 
@@ -499,44 +937,158 @@ namespace Astra
         }
         
         /**
-         * Check if two systems have component access conflicts
+         * Build the dependency graph based on component access patterns
+         * 
+         * Every system depends on the earlier systems it conflicts with. Candidates are visited
+         * from the nearest one backwards, and a candidate that is already an ancestor of a kept
+         * predecessor is skipped, so only direct edges remain.
+         */
+        void BuildDependencyGraph()
+        {
+            const size_t count = m_unitMetadata.size();
+            SystemDependencyGraph& graph = m_dependencyGraph;
+            graph.successors.assign(count, {});
+            graph.predecessorCounts.assign(count, 0);
+            graph.criticalPath.assign(count, 1);
+            graph.roots.clear();
+            
+            std::vector<std::vector<bool>> ancestors(count, std::vector<bool>(count, false));
+            for (size_t j = 0; j < count; ++j)
+            {
+                for (size_t i = j; i-- > 0;)
+                {
+                    if (ancestors[j][i] || !HasConflict(i, j))
+                        continue;
+                    
+                    graph.successors[i].push_back(j);
+                    ++graph.predecessorCounts[j];
+                    ancestors[j][i] = true;
+                    for (size_t k = 0; k < i; ++k)
+                    {
+                        if (ancestors[i][k])
+                            ancestors[j][k] = true;
+                    }
+                }
+            }
+            
+            // Successors are pushed in ascending order of j, and reverse index order is a topological order
+            for (size_t i = count; i-- > 0;)
+            {
+                for (size_t successor : graph.successors[i])
+                {
+                    graph.criticalPath[i] = std::max(graph.criticalPath[i], graph.criticalPath[successor] + 1);
+                }
+            }
+            
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (graph.predecessorCounts[i] == 0)
+                {
+                    graph.roots.push_back(i);
+                }
+            }
+            
+            const auto longerPath = [&graph](size_t a, size_t b)
+            {
+                return graph.criticalPath[a] > graph.criticalPath[b];
+            };
+            const auto shorterPath = [&graph](size_t a, size_t b)
+            {
+                return graph.criticalPath[a] < graph.criticalPath[b];
+            };
+            std::stable_sort(graph.roots.begin(), graph.roots.end(), longerPath);
+            for (auto& successors : graph.successors)
+            {
+                std::stable_sort(successors.begin(), successors.end(), shorterPath);
+            }
+        }
+        
+        /**
+         * Check if two systems have component or resource access conflicts
          * 
          * Systems conflict if:
-         * - Both write to the same component (write-write conflict)
-         * - One reads and another writes the same component (read-write conflict)
+         * - Both write to the same component or resource (write-write conflict)
+         * - One reads and another writes the same component or resource (read-write conflict)
          * - Either system has no hints (conservative approach for safety)
          * 
+         * Component overlap is ignored when both systems iterate known queries whose
+         * archetypes are disjoint and every overlapping component is accessed through
+         * those queries, they never touch the same chunks. Traits may declare access
+         * beyond the query (e.g. writes through the Registry), that keeps the conflict.
+         * 
          * @return true if systems cannot run in parallel
          */
         ASTRA_NODISCARD bool HasConflict(size_t a, size_t b) const
         {
-            const auto& sysA = m_systems[a].metadata;
-            const auto& sysB = m_systems[b].metadata;
+            const auto& sysA = m_unitMetadata[a];
+            const auto& sysB = m_unitMetadata[b];
             
             // Conservative: if either system has no hints, assume conflict
             // This ensures safety when users don't provide Read/Write information
-            if (sysA.reads.None() && sysA.writes.None())
-                return true;
-            if (sysB.reads.None() && sysB.writes.None())
+            if (!HasHints(sysA) || !HasHints(sysB))
                 return true;
             
-            // Check for write-write conflicts
-            if ((sysA.writes & sysB.writes).Any())
+            if (ResourceConflicts(sysA, sysB))
                 return true;
             
-            // Check for read-write conflicts
-            if ((sysA.reads & sysB.writes).Any())
-                return true;
-            if ((sysA.writes & sysB.reads).Any())
-                return true;
+            if (!ComponentConflicts(sysA, sysB))
+                return false;
             
-            return false;
+            return !QueriesCoverConflicts(sysA, sysB) || !ArchetypesDisjoint(a, b);
+        }
+        
+        static bool HasHints(const SystemMetadata& system) noexcept
+        {
+            return system.reads.Any() || system.writes.Any() ||
+                system.resourceReads.Any() || system.resourceWrites.Any();
+        }
+        
+        // Write-write and read-write overlap on components or resources
+        static bool AccessConflicts(const SystemMetadata& a, const SystemMetadata& b) noexcept
+        {
+            return ComponentConflicts(a, b) || ResourceConflicts(a, b);
+        }
+        
+        static bool ComponentConflicts(const SystemMetadata& a, const SystemMetadata& b) noexcept
+        {
+            return (a.writes & b.writes).Any() ||
+                (a.reads & b.writes).Any() ||
+                (a.writes & b.reads).Any();
+        }
+        
+        // Every conflicting component is one both queries access, so disjoint archetypes separate them
+        static bool QueriesCoverConflicts(const SystemMetadata& a, const SystemMetadata& b) noexcept
+        {
+            const ComponentMask overlap = (a.writes & b.writes) | (a.reads & b.writes) | (a.writes & b.reads);
+            return (overlap & a.queryAccess) == overlap && (overlap & b.queryAccess) == overlap;
+        }
+        
+        static bool ResourceConflicts(const SystemMetadata& a, const SystemMetadata& b) noexcept
+        {
+            return (a.resourceWrites & b.resourceWrites).Any() ||
+                (a.resourceReads & b.resourceWrites).Any() ||
+                (a.resourceWrites & b.resourceReads).Any();
         }
         
         std::vector<SystemEntry> m_systems;                             // All registered systems
         FlatMap<size_t, size_t> m_systemIndices;                        // TypeID value to index mapping
         mutable std::vector<std::vector<size_t>> m_executionPlan;       // Cached parallel groups
+        mutable SystemDependencyGraph m_dependencyGraph;                // Cached dependency graph
         mutable bool m_needsRebuild = true;                             // Whether execution plan needs rebuild
+        
+        ArchetypeManager* m_plannedArchetypes = nullptr;                // Archetypes the plan was built for, null for component level
+        uint32_t m_plannedGeneration = 0;                               // Archetype generation the plan was built at
+        uint32_t m_plannedStructuralChange = 0;                         // Structural change counter the plan was built at
+        std::vector<std::vector<Archetype*>> m_systemArchetypes;        // Sorted archetypes matched by each system's query
+        std::vector<bool> m_hasSystemArchetypes;                        // Whether the system's archetypes are known
+        std::vector<std::vector<size_t>> m_units;                       // Systems of each plan index, several when fused
+        std::vector<SystemMetadata> m_unitMetadata;                     // Combined access of each unit
+        std::vector<std::pair<size_t, size_t>> m_disjointPairs;         // Conflicting units made parallel by disjoint archetypes
+        std::vector<std::pair<size_t, size_t>> m_archetypeAccessViolations;
+        std::vector<Archetype*> m_chunkArchetypes;                      // Sorted archetypes matched by any chunk-local system
+        SystemExecutionContext m_context;                               // Context handed to executors, rebuilt with the plan
+        bool m_validateArchetypeAccess = false;
+        bool m_fuseSystems = true;
     };
     
 } // namespace Astra
\ No newline at end of file
@@ -10,6 +10,16 @@ workspace "Astra"
 
     outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
     
+    newoption
+    {
+        trigger = "entity64",
+        description = "Use 64-bit entity handles (32-bit ID, 32-bit version)"
+    }
+    
+    filter "options:entity64"
+        defines { "ASTRA_ENTITY_64" }
+    filter {}
+    
     IncludeDir = {}
     IncludeDir["Astra"] = "include"
     IncludeDir["GoogleTest"] = "vendor/GoogleTest/googletest/include"
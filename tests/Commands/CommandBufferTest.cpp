@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "../TestComponents.hpp"
+#include "Astra/Commands/CommandBuffer.hpp"
+
+using namespace Astra;
+using namespace Astra::Test;
+
+class CommandBufferTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<Registry> registry;
+    
+    void SetUp() override
+    {
+        registry = std::make_unique<Registry>();
+    }
+    
+    void TearDown() override
+    {
+        registry.reset();
+    }
+};
+
+TEST_F(CommandBufferTest, RecordedEntityIsFinalHandle)
+{
+    Entity recorded;
+    {
+        CommandBuffer buffer(registry.get());
+        recorded = buffer.CreateEntity();
+        buffer.AddComponent(recorded, Position{1.0f, 2.0f, 3.0f});
+        buffer.SetComponent(recorded, Velocity{4.0f, 5.0f, 6.0f});
+        
+        // Reserved but not alive until playback
+        EXPECT_TRUE(recorded.IsValid());
+        EXPECT_FALSE(registry->IsValid(recorded));
+        EXPECT_EQ(registry->Size(), 0u);
+        
+        buffer.Execute();
+    }
+    
+    // The handle returned at record time is the entity itself
+    ASSERT_TRUE(registry->IsValid(recorded));
+    EXPECT_EQ(registry->Size(), 1u);
+    
+    auto* pos = registry->GetComponent<Position>(recorded);
+    ASSERT_NE(pos, nullptr);
+    EXPECT_FLOAT_EQ(pos->y, 2.0f);
+    
+    auto* vel = registry->GetComponent<Velocity>(recorded);
+    ASSERT_NE(vel, nullptr);
+    EXPECT_FLOAT_EQ(vel->dz, 6.0f);
+}
+
+TEST_F(CommandBufferTest, RecordedEntitiesInRelationships)
+{
+    Entity parent = registry->CreateEntity();
+    
+    CommandBuffer buffer(registry.get());
+    Entity child = buffer.CreateEntity();
+    Entity doomed = buffer.CreateEntity();
+    buffer.SetParent(child, parent);
+    buffer.DestroyEntity(doomed);
+    buffer.Execute();
+    
+    EXPECT_TRUE(registry->IsValid(child));
+    EXPECT_FALSE(registry->IsValid(doomed));
+    EXPECT_EQ(registry->GetRelationshipGraph().GetParent(child), parent);
+    EXPECT_EQ(registry->Size(), 2u);
+}
+
+TEST_F(CommandBufferTest, ClearReleasesReservedEntities)
+{
+    std::vector<Entity> recorded;
+    {
+        CommandBuffer buffer(registry.get());
+        for (int i = 0; i < 10; ++i)
+        {
+            recorded.push_back(buffer.CreateEntity());
+        }
+        buffer.Clear();
+        
+        // Executing after a clear creates nothing
+        buffer.Execute();
+        EXPECT_EQ(registry->Size(), 0u);
+    }
+    
+    // Released IDs are reused and the recorded handles never become valid
+    for (const Entity& old : recorded)
+    {
+        Entity created = registry->CreateEntity();
+        EXPECT_EQ(created.GetID(), old.GetID());
+        EXPECT_NE(created.GetVersion(), old.GetVersion());
+        EXPECT_FALSE(registry->IsValid(old));
+    }
+}
+
+TEST_F(CommandBufferTest, SaveWithLiveBufferKeepsUnusedIDs)
+{
+    CommandBuffer buffer(registry.get());
+    for (int i = 0; i < 3; ++i)
+    {
+        buffer.AddComponent(buffer.CreateEntity(), Position{});
+    }
+    buffer.Execute();
+    
+    auto saveResult = registry->Save();
+    ASSERT_TRUE(saveResult.IsOk());
+    auto loadResult = Registry::Load(*saveResult.GetValue(), registry->GetComponentRegistry());
+    ASSERT_TRUE(loadResult.IsOk());
+    auto& loaded = *loadResult.GetValue();
+    
+    // The rest of the buffer's block went back to the free set before the save, so it is reused
+    for (int i = 0; i < 61; ++i)
+    {
+        EXPECT_LT(loaded->CreateEntity().GetID(), 64u);
+    }
+    EXPECT_EQ(loaded->Size(), 64u);
+}
+
+TEST_F(CommandBufferTest, RegistryClearWithLiveBuffer)
+{
+    CommandBuffer buffer(registry.get());
+    buffer.CreateEntity();
+    buffer.Execute();
+    
+    registry->Clear();
+    std::vector<Entity> direct;
+    for (int i = 0; i < 5; ++i)
+    {
+        direct.push_back(registry->CreateEntity());
+    }
+    
+    // The buffer reserves from the cleared registry instead of handing out a pre-clear handle
+    Entity recorded = buffer.CreateEntity();
+    buffer.AddComponent(recorded, Position{1.0f, 0.0f, 0.0f});
+    for (Entity entity : direct)
+    {
+        EXPECT_NE(recorded.GetID(), entity.GetID());
+    }
+    buffer.Execute();
+    
+    EXPECT_EQ(registry->Size(), 6u);
+    ASSERT_TRUE(registry->IsValid(recorded));
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(recorded)->x, 1.0f);
+    for (Entity entity : direct)
+    {
+        EXPECT_TRUE(registry->IsValid(entity));
+        EXPECT_EQ(registry->GetComponent<Position>(entity), nullptr);
+    }
+}
+
+TEST_F(CommandBufferTest, ExecuteWithoutClearMaterializesOnce)
+{
+    CommandBuffer buffer(registry.get());
+    Entity entity = buffer.CreateEntity();
+    buffer.Execute(false);
+    ASSERT_TRUE(registry->IsValid(entity));
+    
+    registry->DestroyEntity(entity);
+    buffer.Execute(false);
+    EXPECT_FALSE(registry->IsValid(entity));
+    EXPECT_EQ(registry->Size(), 0u);
+    
+    buffer.Clear();
+    EXPECT_EQ(registry->CreateEntity().GetID(), entity.GetID());
+}
+
+TEST_F(CommandBufferTest, CreateDestroyChurnReusesIDs)
+{
+    std::vector<Entity> live;
+    for (int frame = 0; frame < 500; ++frame)
+    {
+        // Short-lived buffers each reserve a block and release what they did not use
+        CommandBuffer buffer(registry.get());
+        for (Entity entity : live)
+        {
+            buffer.DestroyEntity(entity);
+        }
+        
+        live.clear();
+        for (int i = 0; i < 10; ++i)
+        {
+            live.push_back(buffer.CreateEntity());
+        }
+        buffer.Execute();
+        
+        // Live count is constant, so the IDs in use stay within a couple of reserve blocks
+        for (Entity entity : live)
+        {
+            ASSERT_TRUE(registry->IsValid(entity));
+            EXPECT_LT(entity.GetID(), 256u);
+        }
+    }
+    EXPECT_EQ(registry->Size(), 10u);
+}
+
+TEST_F(CommandBufferTest, ParallelRecordingUsesRealHandles)
+{
+    constexpr size_t threadCount = 4;
+    constexpr size_t perThread = 500;
+    
+    ParallelCommandBuffer commands(*registry);
+    std::vector<std::vector<Entity>> recorded(threadCount);
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&commands, &out = recorded[t]]()
+        {
+            CommandBuffer& buffer = commands.GetThreadBuffer();
+            for (size_t i = 0; i < perThread; ++i)
+            {
+                Entity entity = buffer.CreateEntity();
+                buffer.AddComponent(entity, Health{static_cast<int>(i), 100});
+                out.push_back(entity);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    
+    commands.Execute();
+    EXPECT_EQ(registry->Size(), threadCount * perThread);
+    
+    std::unordered_set<Entity::IDType> ids;
+    for (const auto& handles : recorded)
+    {
+        for (size_t i = 0; i < handles.size(); ++i)
+        {
+            EXPECT_TRUE(ids.insert(handles[i].GetID()).second);
+            ASSERT_TRUE(registry->IsValid(handles[i]));
+            EXPECT_EQ(registry->GetComponent<Health>(handles[i])->current, static_cast<int>(i));
+        }
+    }
+}
@@ -848,4 +848,68 @@ TEST_F(FlatMapTest, HeterogeneousLookup)
     std::string key = "hello";
     EXPECT_TRUE(map.Contains(key));
     EXPECT_EQ(map.Find(key)->second, 1);
-}
\ No newline at end of file
+}
+
+// Test the dispatched control byte scan used by Clear and Rehash
+TEST_F(FlatMapTest, FindFullKernels)
+{
+    namespace Kernels = Astra::Simd::Dispatch::Detail;
+    
+    std::mt19937 rng(7);
+    std::vector<std::uint8_t> control(16 * 9);
+    for (int round = 0; round < 200; ++round)
+    {
+        // Mostly empty and deleted bytes, so full ones land at every offset of a vector
+        for (auto& byte : control)
+        {
+            const unsigned roll = rng() % 16;
+            byte = roll == 0 ? std::uint8_t(rng() % 128) : (roll < 12 ? Astra::SwissTable::EMPTY : Astra::SwissTable::DELETED);
+        }
+        
+        for (size_t start = 0; start <= control.size(); start += 1 + rng() % 11)
+        {
+            size_t expected = start;
+            while (expected < control.size() && control[expected] >= 0x80)
+            {
+                ++expected;
+            }
+            ASSERT_EQ(Kernels::FindFullScalar(control.data(), control.size(), start), expected);
+            ASSERT_EQ(Astra::Simd::Dispatch::FindFull(control.data(), control.size(), start), expected);
+#if defined(ASTRA_ARCH_X64)
+            ASSERT_EQ(Kernels::FindFullSse2(control.data(), control.size(), start), expected);
+            if (Astra::GetCpuFeatures().avx2)
+            {
+                ASSERT_EQ(Kernels::FindFullAvx2(control.data(), control.size(), start), expected);
+            }
+#endif
+        }
+    }
+    
+    // Clear and Rehash visit exactly the live slots, tombstones included
+    Astra::FlatMap<int, std::string> map;
+    for (int i = 0; i < 1000; ++i)
+    {
+        map[i] = std::to_string(i);
+    }
+    for (int i = 0; i < 1000; i += 3)
+    {
+        map.Erase(i);
+    }
+    for (int i = 1000; i < 3000; ++i)
+    {
+        map[i] = std::to_string(i);
+    }
+    for (int i = 0; i < 3000; ++i)
+    {
+        const bool live = i >= 1000 || i % 3 != 0;
+        ASSERT_EQ(map.Contains(i), live) << i;
+        if (live)
+        {
+            ASSERT_EQ(map.Find(i)->second, std::to_string(i));
+        }
+    }
+    
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(std::distance(map.begin(), map.end()), 0);
+}
@@ -0,0 +1,142 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "../TestComponents.hpp"
+#include "Astra/Core/JobSystem.hpp"
+#include "Astra/Registry/Registry.hpp"
+
+TEST(JobSystemTest, ParallelForRunsEveryIndexOnce)
+{
+    Astra::JobSystem jobs(Astra::JobSystem::Config{.workerCount = 3});
+    EXPECT_EQ(jobs.GetWorkerCount(), 3u);
+    
+    for (int round = 0; round < 50; ++round)
+    {
+        std::vector<std::atomic<int>> hits(257);
+        jobs.ParallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+        for (const auto& hit : hits)
+        {
+            ASSERT_EQ(hit.load(), 1);
+        }
+    }
+}
+
+TEST(JobSystemTest, NestedParallelFor)
+{
+    Astra::JobSystem jobs(Astra::JobSystem::Config{.workerCount = 2});
+    
+    // Outer jobs wait on inner batches while helping, so nesting deeper than the worker count
+    // still completes
+    std::atomic<size_t> total{0};
+    jobs.ParallelFor(8, [&](size_t)
+    {
+        jobs.ParallelFor(16, [&](size_t) { total.fetch_add(1, std::memory_order_relaxed); });
+    });
+    EXPECT_EQ(total.load(), 8u * 16u);
+}
+
+TEST(JobSystemTest, ManyShortBatches)
+{
+    Astra::JobSystem jobs(Astra::JobSystem::Config{.workerCount = 3});
+    
+    // Batches live on the caller's stack and are gone as soon as the call returns, so workers
+    // finishing the last job must not touch them afterwards
+    size_t total = 0;
+    for (int round = 0; round < 20000; ++round)
+    {
+        std::atomic<size_t> hits{0};
+        jobs.ParallelFor(4, [&hits](size_t) { hits.fetch_add(1, std::memory_order_relaxed); });
+        total += hits.load();
+        
+        const size_t roots[] = {0};
+        jobs.ParallelSpawn(3, roots, [&hits](size_t i, auto& spawn)
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            if (i < 2)
+                spawn(i + 1);
+        });
+        total += hits.load();
+    }
+    EXPECT_EQ(total, 20000u * (4u + 7u));
+}
+
+TEST(JobSystemTest, RegistryViewsRunOnAttachedPool)
+{
+    using namespace Astra::Test;
+    
+    Astra::Registry registry;
+    auto jobs = std::make_shared<Astra::JobSystem>(Astra::JobSystem::Config{.workerCount = 4});
+    registry.SetJobSystem(jobs);
+    EXPECT_EQ(registry.GetJobSystem(), jobs.get());
+    
+    constexpr size_t ENTITY_COUNT = 50000;
+    for (size_t i = 0; i < ENTITY_COUNT; ++i)
+    {
+        registry.CreateEntityWith(Position{0, 0, 0}, Velocity{1, 2, 3});
+    }
+    
+    auto view = registry.CreateView<Position, Velocity>();
+    std::atomic<size_t> visited{0};
+    view.ParallelForEach([&](Astra::Entity, Position& pos, Velocity& vel)
+    {
+        pos.x += vel.dx;
+        visited.fetch_add(1, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(visited.load(), ENTITY_COUNT);
+    
+    size_t updated = 0;
+    view.ForEach([&](Astra::Entity, Position& pos, Velocity&) { updated += pos.x == 1.0f ? 1 : 0; });
+    EXPECT_EQ(updated, ENTITY_COUNT);
+}
+
+TEST(JobSystemTest, ViewsKeepTheirPoolAlive)
+{
+    using namespace Astra::Test;
+    
+    Astra::Registry registry;
+    registry.SetJobSystem(std::make_shared<Astra::JobSystem>(Astra::JobSystem::Config{.workerCount = 2}));
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        registry.CreateEntityWith(Position{0, 0, 0});
+    }
+    
+    // Replacing the registry's pool must not pull it out from under existing views
+    auto view = registry.CreateView<Position>();
+    registry.SetJobSystem(nullptr);
+    
+    std::atomic<size_t> visited{0};
+    view.ParallelForEach([&](Astra::Entity, Position&) { visited.fetch_add(1, std::memory_order_relaxed); });
+    EXPECT_EQ(visited.load(), 20000u);
+}
+
+#if defined(__cpp_exceptions)
+TEST(JobSystemTest, JobExceptionsReachTheWaiter)
+{
+    Astra::JobSystem jobs(Astra::JobSystem::Config{.workerCount = 3});
+    
+    std::atomic<size_t> finished{0};
+    EXPECT_THROW(jobs.ParallelFor(64, [&](size_t i)
+    {
+        if (i == 17)
+            throw std::runtime_error("job failed");
+        finished.fetch_add(1, std::memory_order_relaxed);
+    }), std::runtime_error);
+    EXPECT_EQ(finished.load(), 63u);
+    
+    // A failed job never spawns its successors, the batch still returns
+    const size_t roots[] = {0};
+    EXPECT_THROW(jobs.ParallelSpawn(4, roots, [](size_t i, auto& spawn)
+    {
+        if (i == 1)
+            throw std::runtime_error("spawned job failed");
+        spawn(i + 1);
+    }), std::runtime_error);
+    
+    // Workers survive and keep running later batches
+    std::atomic<size_t> total{0};
+    jobs.ParallelFor(32, [&](size_t) { total.fetch_add(1, std::memory_order_relaxed); });
+    EXPECT_EQ(total.load(), 32u);
+}
+#endif
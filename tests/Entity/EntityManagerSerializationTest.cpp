@@ -513,4 +513,81 @@ TEST_F(EntityManagerSerializationTest, LargeScale)
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_F(EntityManagerSerializationTest, RecycledVersionsRoundTrip)
+{
+    EntityManager pool;
+    
+    // Push one slot through enough reuses to exercise the full version width
+    Entity e = pool.Create();
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(pool.Destroy(e));
+        e = pool.Create();
+    }
+    ASSERT_TRUE(pool.Destroy(e));
+    
+    const Entity::IDType id = e.GetID();
+    const Entity::VersionType expectedVersion = pool.Create().GetVersion();
+    Entity reused(id, expectedVersion);
+    ASSERT_TRUE(pool.Destroy(reused));
+    
+    std::vector<std::byte> buffer;
+    {
+        BinaryWriter writer(buffer);
+        pool.Serialize(writer);
+        EXPECT_FALSE(writer.HasError());
+    }
+    
+    {
+        BinaryReader reader(buffer);
+        auto result = EntityManager::Deserialize(reader);
+        ASSERT_TRUE(result.IsOk());
+        
+        auto& newPool = *result.GetValue();
+        EXPECT_EQ(newPool->RecycledCount(), 1u);
+        
+        // The recycled slot keeps its next version across the round trip
+        Entity::VersionType nextVersion = reused.GetVersion() + 1;
+        if (nextVersion == EntityManager::NULL_VERSION) nextVersion = EntityManager::INITIAL_VERSION;
+        
+        Entity restored = newPool->Create();
+        EXPECT_EQ(restored.GetID(), id);
+        EXPECT_EQ(restored.GetVersion(), nextVersion);
+        EXPECT_FALSE(newPool->IsValid(reused));
+    }
+}
+
+TEST_F(EntityManagerSerializationTest, RecycledOrderRoundTrip)
+{
+    EntityManager pool;
+    
+    std::vector<Entity> entities;
+    pool.CreateBatch(10000, std::back_inserter(entities));
+    for (size_t i : {8000u, 12u, 4500u, 600u})
+    {
+        ASSERT_TRUE(pool.Destroy(entities[i]));
+    }
+    
+    std::vector<std::byte> buffer;
+    {
+        BinaryWriter writer(buffer);
+        pool.Serialize(writer);
+        EXPECT_FALSE(writer.HasError());
+    }
+    
+    BinaryReader reader(buffer);
+    auto result = EntityManager::Deserialize(reader);
+    ASSERT_TRUE(result.IsOk());
+    
+    // The restored pool still reuses the lowest free ID first
+    auto& newPool = *result.GetValue();
+    for (Entity::IDType expected : {12u, 600u, 4500u, 8000u})
+    {
+        Entity restored = newPool->Create();
+        EXPECT_EQ(restored.GetID(), expected);
+        EXPECT_EQ(restored.GetVersion(), EntityManager::INITIAL_VERSION + 1);
+    }
+    EXPECT_EQ(newPool->RecycledCount(), 0u);
+}
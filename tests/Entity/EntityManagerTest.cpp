@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "Astra/Entity/EntityManager.hpp"
 #include <algorithm>
+#include <random>
 #include <unordered_set>
 #include <vector>
 #include <thread>
@@ -596,4 +597,500 @@ TEST_F(EntityManagerTest, CustomSegmentSize)
             EXPECT_TRUE(pool.IsValid(entity));
         }
     }
-}
\ No newline at end of file
+}
+
+// Test that reusing one slot many times never hands out an aliasing handle
+// while the version space lasts, and that the version never becomes NULL
+TEST_F(EntityManagerTest, VersionChurnStress)
+{
+    Astra::EntityManager pool;
+    
+    Astra::Entity entity = pool.Create();
+    const auto id = entity.GetID();
+    std::vector<Astra::Entity> history;
+    
+    const size_t reuses = 1000;
+    for (size_t i = 0; i < reuses; ++i)
+    {
+        history.push_back(entity);
+        ASSERT_TRUE(pool.Destroy(entity));
+        entity = pool.Create();
+        ASSERT_EQ(entity.GetID(), id);
+        ASSERT_NE(entity.GetVersion(), Astra::EntityManager::NULL_VERSION);
+    }
+    
+    size_t aliasing = 0;
+    for (const auto& stale : history)
+    {
+        if (pool.IsValid(stale)) ++aliasing;
+    }
+    
+#ifdef ASTRA_ENTITY_64
+    // 32-bit versions cannot wrap within this test
+    EXPECT_EQ(aliasing, 0u);
+    EXPECT_EQ(entity.GetVersion(), reuses + 1);
+#else
+    // 8-bit versions wrap every 255 reuses, so some stale handles alias
+    EXPECT_GT(aliasing, 0u);
+#endif
+}
+
+#ifdef ASTRA_ENTITY_64
+// Test IDs beyond the 24-bit limit of 32-bit handles
+TEST_F(EntityManagerTest, StressBeyond24BitIDs)
+{
+    static_assert(sizeof(Astra::Entity) == 8);
+    static_assert(Astra::MAX_ENTITIES > (size_t(1) << 24));
+    
+    Astra::EntityManager pool;
+    
+    const size_t count = (size_t(1) << 24) + 4096;
+    std::vector<Astra::Entity> entities;
+    entities.reserve(count);
+    pool.CreateBatch(count, std::back_inserter(entities));
+    
+    ASSERT_EQ(entities.size(), count);
+    EXPECT_EQ(pool.Size(), count);
+    EXPECT_EQ(entities.back().GetID(), count - 1);
+    EXPECT_TRUE(pool.IsValid(entities.back()));
+    
+    // Churn the top of the ID range and make sure nothing aliases
+    const size_t churn = 100000;
+    size_t destroyed = pool.DestroyBatch(entities.end() - churn, entities.end());
+    EXPECT_EQ(destroyed, churn);
+    
+    std::vector<Astra::Entity> recreated;
+    pool.CreateBatch(churn, std::back_inserter(recreated));
+    ASSERT_EQ(recreated.size(), churn);
+    
+    for (size_t i = 0; i < churn; ++i)
+    {
+        EXPECT_FALSE(pool.IsValid(entities[count - churn + i]));
+        EXPECT_TRUE(pool.IsValid(recreated[i]));
+        EXPECT_GE(recreated[i].GetID(), count - churn);
+    }
+    
+    EXPECT_EQ(pool.Size(), count);
+}
+#endif
+
+// Test batch validation against per-entity IsValid
+TEST_F(EntityManagerTest, IsValidBatch)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> entities;
+    pool.CreateBatch(150, std::back_inserter(entities));
+    
+    // Stale handles, a never-created ID and the invalid handle
+    Astra::Entity stale = entities[3];
+    pool.Destroy(entities[3]);
+    pool.Destroy(entities[70]);
+    entities.push_back(stale);
+    entities.push_back(Astra::Entity(1u << 20, 1));
+    entities.push_back(Astra::Entity::Invalid());
+    entities.push_back(Astra::Entity(entities[5].GetID(), 0));
+    
+    std::vector<uint64_t> mask(Astra::EntityManager::BatchMaskWords(entities.size()), ~0ULL);
+    size_t validCount = pool.IsValidBatch(entities, mask);
+    
+    size_t expectedCount = 0;
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        const bool expected = pool.IsValid(entities[i]);
+        const bool batched = (mask[i / 64] >> (i % 64)) & 1;
+        EXPECT_EQ(batched, expected) << "index " << i;
+        expectedCount += expected;
+    }
+    
+    EXPECT_EQ(validCount, expectedCount);
+    EXPECT_EQ(validCount, 148u);
+    
+    // Bits past the end of the batch are cleared
+    EXPECT_EQ(mask.back() >> (entities.size() % 64), 0u);
+}
+
+// Test batch destruction with duplicate and stale handles
+TEST_F(EntityManagerTest, DestroyBatchDuplicates)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> entities;
+    pool.CreateBatch(200, std::back_inserter(entities));
+    
+    std::vector<Astra::Entity> toDestroy(entities.begin(), entities.begin() + 100);
+    toDestroy.push_back(entities[10]);   // Duplicate in a later block
+    toDestroy.push_back(entities[99]);   // Duplicate in the same block
+    toDestroy.insert(toDestroy.begin() + 50, entities[20]);
+    
+    size_t destroyed = pool.DestroyBatch(toDestroy.begin(), toDestroy.end());
+    EXPECT_EQ(destroyed, 100u);
+    EXPECT_EQ(pool.Size(), 100u);
+    EXPECT_EQ(pool.RecycledCount(), 100u);
+    
+    // Recycled IDs are handed out exactly once
+    std::vector<Astra::Entity> recreated;
+    pool.CreateBatch(100, std::back_inserter(recreated));
+    std::unordered_set<Astra::Entity::IDType> ids;
+    for (const auto& entity : recreated)
+    {
+        EXPECT_TRUE(ids.insert(entity.GetID()).second);
+        EXPECT_LT(entity.GetID(), 100u);
+    }
+}
+
+// Test that recycling hands out the lowest free ID first
+TEST_F(EntityManagerTest, RecyclesLowestIDFirst)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> entities;
+    pool.CreateBatch(10000, std::back_inserter(entities));
+    
+    // Destroy in an order that LIFO reuse would hand back highest-first
+    for (size_t i : {7u, 9000u, 3u, 5000u, 4096u, 4095u})
+    {
+        ASSERT_TRUE(pool.Destroy(entities[i]));
+    }
+    
+    std::vector<Astra::Entity::IDType> reused;
+    for (int i = 0; i < 6; ++i)
+    {
+        reused.push_back(pool.Create().GetID());
+    }
+    
+    std::vector<Astra::Entity::IDType> expected = {3, 7, 4095, 4096, 5000, 9000};
+    EXPECT_EQ(reused, expected);
+    EXPECT_EQ(pool.RecycledCount(), 0u);
+    
+    // Fresh IDs resume once the free set is empty
+    EXPECT_EQ(pool.Create().GetID(), 10000u);
+}
+
+// Test that live IDs stay packed after random churn
+TEST_F(EntityManagerTest, ChurnKeepsIDsPacked)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> entities;
+    pool.CreateBatch(20000, std::back_inserter(entities));
+    
+    // Shrink to a quarter of the population, destroying in random order
+    std::mt19937 rng(1234);
+    std::shuffle(entities.begin(), entities.end(), rng);
+    for (size_t i = 5000; i < entities.size(); ++i)
+    {
+        ASSERT_TRUE(pool.Destroy(entities[i]));
+    }
+    entities.resize(5000);
+    
+    // Destroy the survivors too and rebuild the same population
+    pool.DestroyBatch(entities.begin(), entities.end());
+    entities.clear();
+    pool.CreateBatch(5000, std::back_inserter(entities));
+    
+    Astra::Entity::IDType maxID = 0;
+    for (const auto& entity : entities)
+    {
+        EXPECT_TRUE(pool.IsValid(entity));
+        maxID = std::max(maxID, entity.GetID());
+    }
+    EXPECT_EQ(maxID, 4999u);
+    
+    // Ongoing churn keeps reusing the same low range
+    for (int round = 0; round < 10; ++round)
+    {
+        std::shuffle(entities.begin(), entities.end(), rng);
+        pool.DestroyBatch(entities.begin(), entities.begin() + 1000);
+        entities.erase(entities.begin(), entities.begin() + 1000);
+        pool.CreateBatch(1000, std::back_inserter(entities));
+    }
+    
+    for (const auto& entity : entities)
+    {
+        EXPECT_LT(entity.GetID(), 5000u);
+    }
+    EXPECT_EQ(pool.RecycledCount(), 15000u);
+}
+
+// Test that reusing low IDs first lets emptied trailing segments stay released
+TEST_F(EntityManagerTest, TrailingSegmentsStayReleased)
+{
+    Astra::EntityManager::Config config(1024);
+    config.tableConfig.autoRelease = true;
+    config.tableConfig.maxEmptySegments = 0;
+    Astra::EntityManager pool(config);
+    
+    std::vector<Astra::Entity> entities;
+    pool.CreateBatch(4 * 1024, std::back_inserter(entities));
+    EXPECT_EQ(pool.SegmentCount(), 4u);
+    
+    // Free part of the first segment, then all of the last, which LIFO reuse would hand back first
+    for (size_t i = 0; i < 500; ++i)
+    {
+        ASSERT_TRUE(pool.Destroy(entities[i]));
+    }
+    for (size_t i = 3 * 1024; i < 4 * 1024; ++i)
+    {
+        ASSERT_TRUE(pool.Destroy(entities[i]));
+    }
+    EXPECT_EQ(pool.SegmentCount(), 3u);
+    
+    // Recreating fills the holes in the first segment without bringing the last one back
+    std::vector<Astra::Entity> recreated;
+    pool.CreateBatch(500, std::back_inserter(recreated));
+    for (const auto& entity : recreated)
+    {
+        EXPECT_LT(entity.GetID(), 500u);
+    }
+    EXPECT_EQ(pool.SegmentCount(), 3u);
+    EXPECT_EQ(pool.Size(), 3u * 1024);
+}
+
+// Test that free pages keep reuse versions and are released once their IDs are reused
+TEST_F(EntityManagerTest, FreePagesReleasedOnReuse)
+{
+    using Stack = Astra::EntityIDStack;
+    Stack stack;
+    
+    std::vector<Stack::VersionedID> ids;
+    stack.AllocateBatch(3 * Stack::PAGE_SIZE, std::back_inserter(ids));
+    ASSERT_EQ(ids.size(), 3 * Stack::PAGE_SIZE);
+    
+    // One ID in the first page, a scattered handful in the second, all of the third
+    std::vector<Stack::IDType> freed = {5};
+    for (size_t i = 0; i < Stack::PAGE_SIZE; i += 977)
+    {
+        freed.push_back(static_cast<Stack::IDType>(Stack::PAGE_SIZE + i));
+    }
+    for (size_t i = 0; i < Stack::PAGE_SIZE; ++i)
+    {
+        freed.push_back(static_cast<Stack::IDType>(2 * Stack::PAGE_SIZE + i));
+    }
+    for (Stack::IDType id : freed)
+    {
+        stack.Recycle(id, static_cast<Stack::VersionType>(2 + id % 200));
+    }
+    EXPECT_EQ(stack.FreePageCount(), 3u);
+    EXPECT_EQ(stack.RecycledCount(), freed.size());
+    
+    // Reuse hands back every ID with its version, emptying pages lowest first
+    for (size_t i = 0; i < freed.size(); ++i)
+    {
+        auto [id, version] = stack.Allocate();
+        ASSERT_EQ(id, freed[i]);
+        ASSERT_EQ(version, static_cast<Stack::VersionType>(2 + id % 200));
+        if (i == 0)
+        {
+            EXPECT_EQ(stack.FreePageCount(), 2u);
+        }
+    }
+    EXPECT_EQ(stack.FreePageCount(), 0u);
+    EXPECT_EQ(stack.RecycledCount(), 0u);
+    
+    // A page that fills up again is allocated anew
+    stack.Recycle(4, 9);
+    EXPECT_EQ(stack.FreePageCount(), 1u);
+    EXPECT_EQ(stack.Allocate().version, 9u);
+    EXPECT_EQ(stack.FreePageCount(), 0u);
+}
+
+// Test concurrent entity reservation from several threads
+TEST_F(EntityManagerTest, ReserveEntitiesConcurrent)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> live;
+    pool.CreateBatch(100, std::back_inserter(live));
+    
+    static constexpr size_t threadCount = 4;
+    static constexpr size_t blocksPerThread = 50;
+    static constexpr size_t blockSize = 64;
+    
+    std::vector<std::vector<Astra::Entity>> reserved(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&pool, &out = reserved[t]]()
+        {
+            for (size_t block = 0; block < blocksPerThread; ++block)
+            {
+                EXPECT_EQ(pool.ReserveEntities(blockSize, std::back_inserter(out)), blockSize);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    
+    // Every reserved handle is unique, beyond the live range and not valid yet
+    std::unordered_set<Astra::Entity::IDType> ids;
+    for (const auto& block : reserved)
+    {
+        for (Astra::Entity entity : block)
+        {
+            EXPECT_TRUE(ids.insert(entity.GetID()).second);
+            EXPECT_GE(entity.GetID(), 100u);
+            EXPECT_FALSE(pool.IsValid(entity));
+            EXPECT_TRUE(pool.IsReserved(entity));
+        }
+    }
+    EXPECT_EQ(ids.size(), threadCount * blocksPerThread * blockSize);
+    EXPECT_EQ(pool.Size(), 100u);
+    
+    // Regular creation never hands out a reserved ID
+    Astra::Entity created = pool.Create();
+    EXPECT_EQ(ids.count(created.GetID()), 0u);
+    
+    // Materialize once, a second attempt is rejected
+    Astra::Entity first = reserved[0][0];
+    EXPECT_TRUE(pool.MaterializeReserved(first));
+    EXPECT_TRUE(pool.IsValid(first));
+    EXPECT_FALSE(pool.MaterializeReserved(first));
+    EXPECT_FALSE(pool.ReleaseReserved(first));
+    
+    // A released handle stays invalid even after its ID is reused
+    Astra::Entity second = reserved[0][1];
+    EXPECT_TRUE(pool.ReleaseReserved(second));
+    EXPECT_FALSE(pool.IsReserved(second));
+    EXPECT_FALSE(pool.MaterializeReserved(second));
+    Astra::Entity reused = pool.Create();
+    EXPECT_EQ(reused.GetID(), second.GetID());
+    EXPECT_FALSE(pool.IsValid(second));
+    
+    // Destroyed after materializing, the handle cannot be brought back
+    ASSERT_TRUE(pool.Destroy(first));
+    EXPECT_FALSE(pool.MaterializeReserved(first));
+}
+
+// Concurrent reservers share the free set first and then fall through to fresh IDs
+TEST_F(EntityManagerTest, ReserveEntitiesConcurrentFromFreeSet)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> live;
+    pool.CreateBatch(1000, std::back_inserter(live));
+    for (size_t i = 0; i < live.size(); i += 2)
+    {
+        ASSERT_TRUE(pool.Destroy(live[i]));
+    }
+    
+    static constexpr size_t threadCount = 4;
+    static constexpr size_t blocksPerThread = 20;
+    static constexpr size_t blockSize = 16;
+    
+    std::vector<std::vector<Astra::Entity>> reserved(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&pool, &out = reserved[t]]()
+        {
+            for (size_t block = 0; block < blocksPerThread; ++block)
+            {
+                EXPECT_EQ(pool.ReserveEntities(blockSize, std::back_inserter(out)), blockSize);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    
+    // All 500 freed IDs are taken before any fresh one
+    std::unordered_set<Astra::Entity::IDType> ids;
+    size_t recycled = 0;
+    for (const auto& block : reserved)
+    {
+        for (Astra::Entity entity : block)
+        {
+            EXPECT_TRUE(ids.insert(entity.GetID()).second);
+            EXPECT_TRUE(pool.IsReserved(entity));
+            recycled += entity.GetID() < 1000 ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(recycled, 500u);
+    EXPECT_EQ(pool.RecycledCount(), 0u);
+    EXPECT_EQ(pool.Capacity(), 1000u + threadCount * blocksPerThread * blockSize - 500u);
+}
+
+// Reservations take free IDs first, so reserve/destroy churn keeps the ID range bounded
+TEST_F(EntityManagerTest, ReserveEntitiesReusesFreeIDs)
+{
+    Astra::EntityManager pool;
+    
+    std::vector<Astra::Entity> live;
+    pool.CreateBatch(200, std::back_inserter(live));
+    const size_t idRange = pool.Capacity();
+    
+    for (int round = 0; round < 1000; ++round)
+    {
+        // Destroy half, reserve replacements, materialize some and release the rest
+        std::vector<Astra::Entity> survivors;
+        for (size_t i = 0; i < live.size(); ++i)
+        {
+            if (i % 2 == 0)
+            {
+                ASSERT_TRUE(pool.Destroy(live[i]));
+            }
+            else
+            {
+                survivors.push_back(live[i]);
+            }
+        }
+        
+        std::vector<Astra::Entity> reserved;
+        ASSERT_EQ(pool.ReserveEntities(live.size() - survivors.size() + 16, std::back_inserter(reserved)), live.size() - survivors.size() + 16);
+        for (size_t i = 0; i < reserved.size(); ++i)
+        {
+            ASSERT_TRUE(pool.IsReserved(reserved[i]));
+            if (survivors.size() < live.size())
+            {
+                ASSERT_TRUE(pool.MaterializeReserved(reserved[i]));
+                survivors.push_back(reserved[i]);
+            }
+            else
+            {
+                ASSERT_TRUE(pool.ReleaseReserved(reserved[i]));
+            }
+        }
+        live = std::move(survivors);
+    }
+    
+    EXPECT_EQ(pool.Size(), 200u);
+    EXPECT_LE(pool.Capacity(), idRange + 16);
+}
+
+// Only the exact handle handed out counts as reserved
+TEST_F(EntityManagerTest, ReservedHandleVersionMustMatch)
+{
+    Astra::EntityManager pool;
+    
+    Astra::Entity old = pool.Create();
+    ASSERT_TRUE(pool.Destroy(old));
+    
+    std::vector<Astra::Entity> reserved;
+    ASSERT_EQ(pool.ReserveEntities(2, std::back_inserter(reserved)), 2u);
+    
+    // The freed ID comes back with its reuse version, the stale and initial handles are rejected
+    Astra::Entity recycled = reserved[0];
+    EXPECT_EQ(recycled.GetID(), old.GetID());
+    EXPECT_NE(recycled.GetVersion(), old.GetVersion());
+    EXPECT_FALSE(pool.IsReserved(old));
+    EXPECT_FALSE(pool.IsReserved(Astra::Entity(old.GetID(), Astra::EntityManager::INITIAL_VERSION)));
+    EXPECT_FALSE(pool.MaterializeReserved(old));
+    EXPECT_TRUE(pool.IsReserved(recycled));
+    
+    // A fresh reservation only matches with the initial version
+    Astra::Entity fresh = reserved[1];
+    EXPECT_EQ(fresh.GetVersion(), Astra::EntityManager::INITIAL_VERSION);
+    EXPECT_FALSE(pool.IsReserved(Astra::Entity(fresh.GetID(), fresh.GetVersion() + 1)));
+    EXPECT_FALSE(pool.ReleaseReserved(Astra::Entity(fresh.GetID(), fresh.GetVersion() + 1)));
+    
+    EXPECT_TRUE(pool.MaterializeReserved(recycled));
+    EXPECT_TRUE(pool.IsValid(recycled));
+    EXPECT_FALSE(pool.IsReserved(recycled));
+    EXPECT_TRUE(pool.ReleaseReserved(fresh));
+    EXPECT_FALSE(pool.IsReserved(fresh));
+    EXPECT_EQ(pool.RecycledCount(), 1u);
+}
@@ -1,7 +1,9 @@
 #include <algorithm>
+#include <atomic>
 #include <gtest/gtest.h>
 #include <numeric>
 #include <random>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 #include "../TestComponents.hpp"
@@ -288,6 +290,124 @@ TEST_F(ArchetypeManagerTest, ArchetypeQuerying)
     EXPECT_EQ(posVelCount, 2u); // 2 archetypes have both Position and Velocity
 }
 
+// Test that indexed queries agree with a full scan as archetypes come and go
+TEST_F(ArchetypeManagerTest, ComponentIndexQueries)
+{
+    using namespace Astra::Test;
+    
+    for (int i = 0; i < 16; ++i)
+    {
+        Astra::Entity entity(i, 1);
+        manager->AddEntity(entity);
+        if (i & 1) manager->AddComponent<Position>(entity);
+        if (i & 2) manager->AddComponent<Velocity>(entity);
+        if (i & 4) manager->AddComponent<Health>(entity);
+        if (i & 8) manager->AddComponent<Player>(entity);
+    }
+    
+    const std::vector<Astra::ComponentMask> masks = {
+        Astra::ComponentMask{},
+        Astra::MakeComponentMask<Position>(),
+        Astra::MakeComponentMask<Position, Velocity>(),
+        Astra::MakeComponentMask<Health, Player>(),
+        Astra::MakeComponentMask<Position, Velocity, Health, Player>()
+    };
+    
+    auto check = [&]()
+    {
+        for (const auto& mask : masks)
+        {
+            std::vector<Astra::Archetype*> expected;
+            for (Astra::Archetype* archetype : manager->GetAllArchetypes())
+            {
+                if (archetype->GetMask().HasAll(mask))
+                {
+                    expected.push_back(archetype);
+                }
+            }
+            EXPECT_EQ(manager->QueryArchetypes(mask), expected);
+        }
+    };
+    
+    check();
+    EXPECT_EQ(manager->QueryArchetypes(masks[4]).size(), 1u);
+    
+    // Removed archetypes leave the index
+    for (int i = 0; i < 16; i += 2)
+    {
+        manager->RemoveEntity(Astra::Entity(i, 1));
+    }
+    manager->UpdateArchetypeMetrics();
+    
+    Astra::ArchetypeManager::CleanupOptions options;
+    options.minEmptyDuration = 1;
+    options.minArchetypesToKeep = 1;
+    EXPECT_GT(manager->CleanupEmptyArchetypes(options), 0u);
+    
+    check();
+    EXPECT_EQ(manager->QueryArchetypes(Astra::MakeComponentMask<Velocity>()).size(), 4u);  // Only archetypes with Position kept entities
+}
+
+namespace
+{
+    bool HasPosition(const Astra::ComponentMask& mask)
+    {
+        return mask.HasAll(Astra::MakeComponentMask<Astra::Test::Position>());
+    }
+}
+
+// Cached query lists are copied under the query lock, so readers may run alongside archetype creation
+TEST_F(ArchetypeManagerTest, QueryCopiesAlongsideNewArchetypes)
+{
+    using namespace Astra::Test;
+    
+    const Astra::ComponentMask position = Astra::MakeComponentMask<Position>();
+    const size_t combinations = 128;  // Position with any subset of seven other components
+    
+    const auto& query = manager->GetQuery(&HasPosition, position);
+    std::atomic<bool> done{false};
+    std::thread reader([&]()
+    {
+        std::vector<Astra::Archetype*> archetypes;
+        uint64_t version = 0;
+        size_t previous = 0;
+        while (!done.load(std::memory_order_acquire))
+        {
+            if (manager->CopyQueryArchetypes(query, archetypes, version))
+            {
+                EXPECT_GE(archetypes.size(), previous);
+                previous = archetypes.size();
+                for (Astra::Archetype* archetype : archetypes)
+                {
+                    EXPECT_TRUE(HasPosition(archetype->GetMask()));
+                }
+            }
+        }
+    });
+    
+    for (size_t bits = 0; bits < combinations; ++bits)
+    {
+        Astra::Entity entity(static_cast<Astra::Entity::IDType>(bits), 1);
+        manager->AddEntity(entity);
+        manager->AddComponent<Position>(entity);
+        if (bits & 1) manager->AddComponent<Velocity>(entity);
+        if (bits & 2) manager->AddComponent<Health>(entity);
+        if (bits & 4) manager->AddComponent<Transform>(entity);
+        if (bits & 8) manager->AddComponent<Name>(entity);
+        if (bits & 16) manager->AddComponent<Physics>(entity);
+        if (bits & 32) manager->AddComponent<Player>(entity);
+        if (bits & 64) manager->AddComponent<Enemy>(entity);
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+    
+    std::vector<Astra::Archetype*> archetypes;
+    uint64_t version = 0;
+    EXPECT_TRUE(manager->CopyQueryArchetypes(query, archetypes, version));
+    EXPECT_EQ(archetypes.size(), combinations);
+    EXPECT_FALSE(manager->CopyQueryArchetypes(query, archetypes, version));
+}
+
 // Test archetype cleanup
 TEST_F(ArchetypeManagerTest, ArchetypeCleanup)
 {
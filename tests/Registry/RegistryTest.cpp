@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 #include <gtest/gtest.h>
 #include <numeric>
 #include <random>
@@ -144,6 +145,52 @@ TEST_F(RegistryTest, BatchEntityDestruction)
     }
 }
 
+// Test batch destruction skips stale and duplicate handles
+TEST_F(RegistryTest, BatchEntityDestructionMixed)
+{
+    using namespace Astra::Test;
+    
+    std::vector<Astra::Entity> entities;
+    for (int i = 0; i < 100; ++i)
+    {
+        Astra::Entity entity = registry->CreateEntity();
+        registry->AddComponent<Position>(entity, float(i), 0.0f, 0.0f);
+        entities.push_back(entity);
+    }
+    
+    Astra::Entity stale = entities[0];
+    registry->DestroyEntity(stale);
+    Astra::Entity reused = registry->CreateEntity();
+    
+    // Newest first, so any reordering of the batch shows up in the signal order
+    std::vector<Astra::Entity> toDestroy(entities.rend() - 80, entities.rend());
+    toDestroy.push_back(Astra::Entity::Invalid());
+    toDestroy.push_back(entities[5]);
+    toDestroy.push_back(entities[79]);
+    
+    std::vector<Astra::Entity> destroyedSignals;
+    registry->EnableSignals(Astra::Signal::EntityDestroyed);
+    registry->GetSignalManager().On<Astra::Events::EntityDestroyed>().Register([&destroyedSignals](const Astra::Events::EntityDestroyed& event)
+    {
+        destroyedSignals.push_back(event.entity);
+    });
+    
+    registry->DestroyEntities(toDestroy);
+    
+    // The stale handle must not take the recycled slot down with it, duplicates are destroyed once
+    // at their first position
+    EXPECT_TRUE(registry->IsValid(reused));
+    EXPECT_EQ(registry->Size(), 21u);
+    std::vector<Astra::Entity> expectedSignals(entities.rend() - 80, entities.rend() - 1);
+    EXPECT_EQ(destroyedSignals, expectedSignals);
+    
+    for (size_t i = 80; i < entities.size(); ++i)
+    {
+        ASSERT_TRUE(registry->IsValid(entities[i]));
+        EXPECT_EQ(registry->GetComponent<Position>(entities[i])->x, float(i));
+    }
+}
+
 // Test component addition and removal
 TEST_F(RegistryTest, ComponentOperations)
 {
@@ -822,3 +869,156 @@ TEST_F(RegistryTest, SerializationErrorHandling)
         EXPECT_TRUE(loadResult.IsErr());
     }
 }
+
+TEST_F(RegistryTest, BatchedComponentGather)
+{
+    using namespace Astra::Test;
+    
+    // Enough entities to cycle both lookahead stages, with a few gaps
+    std::vector<Astra::Entity> entities;
+    for (int i = 0; i < 50; ++i)
+    {
+        Astra::Entity entity = registry->CreateEntityWith(Position(float(i), 0.0f, 0.0f));
+        if (i % 3 == 0)
+        {
+            registry->AddComponent<Velocity>(entity, float(i), 0.0f, 0.0f);
+        }
+        entities.push_back(entity);
+    }
+    Astra::Entity destroyed = entities[7];
+    registry->DestroyEntity(destroyed);
+    std::reverse(entities.begin(), entities.end());
+    
+    std::vector<Position*> positions(entities.size());
+    std::vector<Velocity*> velocities(entities.size());
+    registry->GetComponents<Position, Velocity>(entities, std::span<Position*>(positions), std::span<Velocity*>(velocities));
+    
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        EXPECT_EQ(positions[i], registry->GetComponent<Position>(entities[i]));
+        EXPECT_EQ(velocities[i], registry->GetComponent<Velocity>(entities[i]));
+    }
+    EXPECT_EQ(positions[entities.size() - 1 - 7], nullptr);
+    
+    // Only entities with every component are visited, in list order
+    std::vector<Astra::Entity> visited;
+    registry->ForEachEntity<Position, Velocity>(entities, [&](Astra::Entity entity, Position& pos, Velocity& vel)
+    {
+        EXPECT_FLOAT_EQ(pos.x, vel.dx);
+        pos.y = 1.0f;
+        visited.push_back(entity);
+    });
+    
+    std::vector<Astra::Entity> expected;
+    for (Astra::Entity entity : entities)
+    {
+        if (registry->HasComponent<Velocity>(entity))
+        {
+            expected.push_back(entity);
+        }
+    }
+    EXPECT_EQ(visited, expected);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(expected.front())->y, 1.0f);
+    
+    // Short lists that never fill the window
+    std::array<Astra::Entity, 2> few{entities[0], destroyed};
+    size_t count = 0;
+    registry->ForEachEntity<Position>(few, [&](Astra::Entity, Position&) { ++count; });
+    EXPECT_EQ(count, 1u);
+}
+
+TEST_F(RegistryTest, EntityRefFollowsStructuralChanges)
+{
+    using namespace Astra::Test;
+    
+    Astra::Entity target = registry->CreateEntityWith(Position(1.0f, 2.0f, 3.0f));
+    std::vector<Astra::Entity> others;
+    for (int i = 0; i < 10; ++i)
+    {
+        others.push_back(registry->CreateEntityWith(Position(float(i), 0.0f, 0.0f)));
+    }
+    
+    Astra::EntityRef ref = registry->GetEntityRef(target);
+    EXPECT_EQ(ref.GetEntity(), target);
+    ASSERT_NE(ref.Get<Position>(), nullptr);
+    EXPECT_FLOAT_EQ(ref.Get<Position>()->y, 2.0f);
+    EXPECT_EQ(ref.Get<Velocity>(), nullptr);
+    
+    // Swap-remove in the same archetype moves the last row into the destroyed one
+    Astra::Entity last = registry->CreateEntityWith(Position(9.0f, 9.0f, 9.0f));
+    Astra::EntityRef lastRef = registry->GetEntityRef(last);
+    Position* before = lastRef.Get<Position>();
+    ASSERT_NE(before, nullptr);
+    
+    registry->DestroyEntity(target);
+    EXPECT_FALSE(ref.IsAlive());
+    EXPECT_EQ(ref.Get<Position>(), nullptr);
+    
+    Position* after = lastRef.Get<Position>();
+    ASSERT_NE(after, nullptr);
+    EXPECT_NE(after, before);
+    EXPECT_EQ(after, registry->GetComponent<Position>(last));
+    EXPECT_FLOAT_EQ(after->x, 9.0f);
+    EXPECT_FLOAT_EQ(after->y, 9.0f);
+    
+    // Moving to another archetype and back
+    registry->AddComponent<Velocity>(last, 1.0f, 0.0f, 0.0f);
+    ASSERT_NE(lastRef.Get<Velocity>(), nullptr);
+    EXPECT_FLOAT_EQ(lastRef.Get<Velocity>()->dx, 1.0f);
+    EXPECT_FLOAT_EQ(lastRef.Get<Position>()->z, 9.0f);
+    
+    registry->RemoveComponent<Velocity>(last);
+    EXPECT_EQ(lastRef.Get<Velocity>(), nullptr);
+    EXPECT_EQ(lastRef.Get<Position>(), registry->GetComponent<Position>(last));
+    
+    // Writes through the ref land in storage
+    lastRef.Get<Position>()->x = 42.0f;
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(last)->x, 42.0f);
+    
+    Astra::EntityRef empty;
+    EXPECT_FALSE(empty.IsAlive());
+    EXPECT_EQ(empty.Get<Position>(), nullptr);
+}
+
+TEST_F(RegistryTest, Resources)
+{
+    struct GameClock
+    {
+        double elapsed = 0.0;
+        int frame = 0;
+    };
+    
+    struct Tracked
+    {
+        int* destroyed;
+        ~Tracked() { ++*destroyed; }
+    };
+    
+    EXPECT_EQ(registry->GetResource<GameClock>(), nullptr);
+    EXPECT_FALSE(registry->HasResource<GameClock>());
+    
+    GameClock& clock = registry->SetResource<GameClock>(GameClock{1.5, 3});
+    EXPECT_TRUE(registry->HasResource<GameClock>());
+    EXPECT_EQ(registry->GetResource<GameClock>(), &clock);
+    registry->GetResource<GameClock>()->frame++;
+    
+    const Astra::Registry& constRegistry = *registry;
+    EXPECT_EQ(constRegistry.GetResource<GameClock>()->frame, 4);
+    EXPECT_DOUBLE_EQ(constRegistry.GetResource<GameClock>()->elapsed, 1.5);
+    
+    // Replacing and removing destroy the old value, so does the registry
+    int destroyed = 0;
+    registry->SetResource<Tracked>(&destroyed);
+    registry->SetResource<Tracked>(&destroyed);
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_TRUE(registry->RemoveResource<Tracked>());
+    EXPECT_FALSE(registry->RemoveResource<Tracked>());
+    EXPECT_EQ(destroyed, 2);
+    
+    // Resources are not entity data, Clear leaves them alone
+    registry->SetResource<Tracked>(&destroyed);
+    registry->Clear();
+    EXPECT_EQ(registry->GetResource<GameClock>()->frame, 4);
+    registry.reset();
+    EXPECT_EQ(destroyed, 3);
+}
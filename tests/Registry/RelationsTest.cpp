@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <cstdlib>
+#include <new>
 #include <unordered_set>
 #include <chrono>
 #include "Astra/Registry/Registry.hpp"
@@ -9,6 +11,29 @@
 using namespace Astra;
 using namespace Astra::Test;
 
+// Heap allocations made by the current thread, to check that traversals stop allocating
+static thread_local size_t t_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+    ++t_allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    std::abort();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
 class RelationsTest : public ::testing::Test
 {
 protected:
@@ -595,4 +620,466 @@ TEST_F(RelationsTest, CircularHierarchyHandling)
     // Should also handle the cycle gracefully
     // From a's perspective looking up, we see c (parent), then b (grandparent)
     EXPECT_EQ(count, 2u);
-}
\ No newline at end of file
+}
+
+// Children stored as (ChildOf, parent) pairs share an archetype per parent
+TEST_F(RelationsTest, ChildOfPairsGroupSiblings)
+{
+    Registry::Config config;
+    config.childOfPairs = true;
+    Registry pairRegistry(registry->GetComponentRegistry(), config);
+    auto& archetypes = pairRegistry.GetArchetypeManager();
+    
+    Entity parentA = pairRegistry.CreateEntity();
+    Entity parentB = pairRegistry.CreateEntity();
+    std::vector<Entity> childrenA;
+    for (int i = 0; i < 10; ++i)
+    {
+        Entity child = pairRegistry.CreateEntityWith(Position(float(i), 0.0f, 0.0f));
+        pairRegistry.SetParent(child, parentA);
+        childrenA.push_back(child);
+    }
+    Entity childB = pairRegistry.CreateEntityWith(Position(100.0f, 0.0f, 0.0f));
+    pairRegistry.SetParent(childB, parentB);
+    
+    EXPECT_EQ(archetypes.GetPairTarget(childrenA[0]), parentA);
+    EXPECT_EQ(archetypes.GetPairTarget(childB), parentB);
+    EXPECT_TRUE(pairRegistry.HasComponent<ChildOf>(childB));
+    
+    auto pairA = archetypes.GetPairArchetypes(parentA);
+    ASSERT_EQ(pairA.size(), 1u);
+    EXPECT_EQ(pairA[0]->GetEntityCount(), 10u);
+    EXPECT_NE(pairA[0], archetypes.GetPairArchetypes(parentB)[0]);
+    
+    // Filtered ForEachChild streams the shared chunks
+    float sum = 0.0f;
+    size_t visited = 0;
+    pairRegistry.GetRelations<Position>(parentA).ForEachChild([&](Entity, Position& pos)
+    {
+        sum += pos.x;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 10u);
+    EXPECT_FLOAT_EQ(sum, 45.0f);
+    
+    size_t withVelocity = 0;
+    pairRegistry.GetRelations<Velocity>(parentA).ForEachChild([&](Entity, Velocity&) { ++withVelocity; });
+    EXPECT_EQ(withVelocity, 0u);
+    
+    // Adding a component keeps the pair
+    pairRegistry.AddComponent<Velocity>(childrenA[0]);
+    EXPECT_EQ(archetypes.GetPairTarget(childrenA[0]), parentA);
+    pairRegistry.GetRelations<Velocity>(parentA).ForEachChild([&](Entity, Velocity&) { ++withVelocity; });
+    EXPECT_EQ(withVelocity, 1u);
+}
+
+TEST_F(RelationsTest, ChildOfPairsReparentAndDestroy)
+{
+    Registry::Config config;
+    config.childOfPairs = true;
+    Registry pairRegistry(registry->GetComponentRegistry(), config);
+    auto& archetypes = pairRegistry.GetArchetypeManager();
+    
+    Entity parentA = pairRegistry.CreateEntity();
+    Entity parentB = pairRegistry.CreateEntity();
+    Entity child1 = pairRegistry.CreateEntityWith(Position(1.0f, 2.0f, 3.0f));
+    Entity child2 = pairRegistry.CreateEntity<Position>();
+    pairRegistry.SetParent(child1, parentA);
+    pairRegistry.SetParent(child2, parentA);
+    
+    // Reparenting moves the child between pair archetypes, keeping its data
+    pairRegistry.SetParent(child1, parentB);
+    EXPECT_EQ(archetypes.GetPairTarget(child1), parentB);
+    EXPECT_FLOAT_EQ(pairRegistry.GetComponent<Position>(child1)->y, 2.0f);
+    
+    // Removing the parent drops the tag
+    pairRegistry.RemoveParent(child1);
+    EXPECT_FALSE(archetypes.GetPairTarget(child1).IsValid());
+    EXPECT_FALSE(pairRegistry.HasComponent<ChildOf>(child1));
+    
+    // Destroying the parent releases its children from the pair
+    pairRegistry.DestroyEntity(parentA);
+    EXPECT_FALSE(archetypes.GetPairTarget(child2).IsValid());
+    EXPECT_FALSE(pairRegistry.HasComponent<ChildOf>(child2));
+    EXPECT_NE(pairRegistry.GetComponent<Position>(child2), nullptr);
+}
+
+// Pair archetypes of destroyed parents are reused, so parent churn keeps the archetype count flat
+TEST_F(RelationsTest, ChildOfPairsParentChurn)
+{
+    Registry::Config config;
+    config.childOfPairs = true;
+    Registry pairRegistry(registry->GetComponentRegistry(), config);
+    auto& archetypes = pairRegistry.GetArchetypeManager();
+    
+    Entity child = pairRegistry.CreateEntityWith(Position(1.0f, 0.0f, 0.0f));
+    
+    // A rejected self link leaves the child unpaired
+    pairRegistry.SetParent(child, child);
+    EXPECT_FALSE(archetypes.GetPairTarget(child).IsValid());
+    EXPECT_FALSE(pairRegistry.HasComponent<ChildOf>(child));
+    
+    size_t archetypeCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        Entity parent = pairRegistry.CreateEntity();
+        pairRegistry.SetParent(child, parent);
+        
+        // Transitions of a reused archetype stay with the new parent
+        pairRegistry.AddComponent<Velocity>(child);
+        EXPECT_EQ(archetypes.GetPairTarget(child), parent);
+        pairRegistry.RemoveComponent<Velocity>(child);
+        EXPECT_EQ(archetypes.GetPairTarget(child), parent);
+        ASSERT_EQ(archetypes.GetPairArchetypes(parent).size(), 2u);
+        
+        pairRegistry.DestroyEntity(parent);
+        EXPECT_TRUE(archetypes.GetPairArchetypes(parent).empty());
+        EXPECT_FALSE(pairRegistry.HasComponent<ChildOf>(child));
+        
+        if (i == 0)
+        {
+            archetypeCount = archetypes.GetArchetypeCount();
+        }
+        EXPECT_EQ(archetypes.GetArchetypeCount(), archetypeCount);
+    }
+    EXPECT_FLOAT_EQ(pairRegistry.GetComponent<Position>(child)->x, 1.0f);
+}
+
+TEST_F(RelationsTest, ChildOfPairsSaveLoad)
+{
+    Registry::Config config;
+    config.childOfPairs = true;
+    Registry pairRegistry(registry->GetComponentRegistry(), config);
+    
+    Entity parent = pairRegistry.CreateEntity();
+    Entity child = pairRegistry.CreateEntityWith(Position(5.0f, 0.0f, 0.0f));
+    pairRegistry.SetParent(child, parent);
+    
+    auto saveResult = pairRegistry.Save();
+    ASSERT_TRUE(saveResult.IsOk());
+    auto loadResult = Registry::Load(*saveResult.GetValue(), registry->GetComponentRegistry());
+    ASSERT_TRUE(loadResult.IsOk());
+    auto& loaded = *loadResult.GetValue();
+    
+    EXPECT_EQ(loaded->GetArchetypeManager().GetPairTarget(child), parent);
+    
+    // The flag survives, so new parents are paired too
+    Entity child2 = loaded->CreateEntity<Position>();
+    loaded->SetParent(child2, parent);
+    EXPECT_EQ(loaded->GetArchetypeManager().GetPairArchetypes(parent).size(), 1u);
+    EXPECT_EQ(loaded->GetArchetypeManager().GetPairArchetypes(parent)[0]->GetEntityCount(), 2u);
+}
+
+// Pair archetypes retired with their destroyed parent stay reusable after a round trip
+TEST_F(RelationsTest, ChildOfPairsRetiredSaveLoad)
+{
+    Registry::Config config;
+    config.childOfPairs = true;
+    Registry pairRegistry(registry->GetComponentRegistry(), config);
+    
+    Entity parent = pairRegistry.CreateEntity();
+    Entity child = pairRegistry.CreateEntityWith(Position(5.0f, 0.0f, 0.0f));
+    pairRegistry.SetParent(child, parent);
+    pairRegistry.DestroyEntity(parent);
+    ASSERT_TRUE(pairRegistry.GetArchetypeManager().GetPairArchetypes(parent).empty());
+    
+    auto saveResult = pairRegistry.Save();
+    ASSERT_TRUE(saveResult.IsOk());
+    auto loadResult = Registry::Load(*saveResult.GetValue(), registry->GetComponentRegistry());
+    ASSERT_TRUE(loadResult.IsOk());
+    auto& loaded = *loadResult.GetValue();
+    auto& archetypes = loaded->GetArchetypeManager();
+    
+    // Not filed under the dead parent
+    EXPECT_TRUE(archetypes.GetPairArchetypes(parent).empty());
+    
+    // A new parent takes the retired archetype instead of creating one
+    const size_t archetypeCount = archetypes.GetArchetypeCount();
+    Entity newParent = loaded->CreateEntity();
+    loaded->SetParent(child, newParent);
+    EXPECT_EQ(archetypes.GetPairTarget(child), newParent);
+    ASSERT_EQ(archetypes.GetPairArchetypes(newParent).size(), 1u);
+    EXPECT_EQ(archetypes.GetArchetypeCount(), archetypeCount);
+    EXPECT_FLOAT_EQ(loaded->GetComponent<Position>(child)->x, 5.0f);
+}
+
+// Parent-first propagation sees final parent values, sequentially and per level in parallel
+TEST_F(RelationsTest, HierarchyViewPropagatesParentFirst)
+{
+    Entity root = registry->CreateEntityWith(Position(1.0f, 0.0f, 0.0f));
+    std::vector<Entity> level1;
+    std::vector<Entity> level2;
+    for (int i = 0; i < 50; ++i)
+    {
+        Entity child = registry->CreateEntityWith(Position(1.0f, 0.0f, 0.0f));
+        registry->SetParent(child, root);
+        level1.push_back(child);
+    }
+    for (int i = 0; i < 5000; ++i)
+    {
+        Entity child = registry->CreateEntityWith(Position(1.0f, 0.0f, 0.0f));
+        registry->SetParent(child, level1[i % level1.size()]);
+        level2.push_back(child);
+    }
+    
+    // Members without the component are skipped, their children see no parent data
+    Entity bare = registry->CreateEntity();
+    Entity underBare = registry->CreateEntityWith(Position(1.0f, 0.0f, 0.0f));
+    registry->SetParent(underBare, bare);
+    
+    auto propagate = [](Entity, Position& pos, const Position* parent)
+    {
+        if (parent)
+        {
+            pos.x += parent->x;
+        }
+    };
+    
+    auto view = registry->GetHierarchyView<Position>();
+    EXPECT_EQ(view.GetLevelCount(), 3u);
+    
+    view.ForEach(propagate);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(root)->x, 1.0f);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(level1[7])->x, 2.0f);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(level2[123])->x, 3.0f);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(underBare)->x, 1.0f);
+    
+    // Without a pool attached the levels run on the calling thread
+    view.ParallelForEach(propagate);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(root)->x, 1.0f);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(level1[7])->x, 3.0f);
+    for (Entity entity : level2)
+    {
+        ASSERT_FLOAT_EQ(registry->GetComponent<Position>(entity)->x, 6.0f);
+    }
+    
+    // With one, the wide level is split across its workers
+    registry->SetJobSystem(std::make_shared<Astra::JobSystem>(Astra::JobSystem::Config{.workerCount = 3}));
+    registry->GetHierarchyView<Position>().ParallelForEach(propagate);
+    EXPECT_FLOAT_EQ(registry->GetComponent<Position>(level1[7])->x, 4.0f);
+    for (Entity entity : level2)
+    {
+        ASSERT_FLOAT_EQ(registry->GetComponent<Position>(entity)->x, 10.0f);
+    }
+}
+
+// Caller-owned scratch buffers are reused across traversals
+TEST_F(RelationsTest, TraversalReusesScratch)
+{
+    Entity root = registry->CreateEntityWith(Position());
+    std::vector<Entity> frontier{root};
+    size_t total = 0;
+    for (int depth = 0; depth < 4; ++depth)
+    {
+        std::vector<Entity> next;
+        for (Entity parent : frontier)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                Entity child = registry->CreateEntityWith(Position());
+                registry->SetParent(child, parent);
+                next.push_back(child);
+                ++total;
+            }
+        }
+        frontier = std::move(next);
+    }
+    
+    TraversalScratch scratch;
+    auto relations = registry->GetRelations<Position>(root);
+    
+    size_t count = 0;
+    for (auto entry : relations.GetDescendants(&scratch))
+    {
+        (void)entry;
+        ++count;
+    }
+    EXPECT_EQ(count, total);
+    
+    // Trees never need the visited set
+    EXPECT_TRUE(scratch.visited.Empty());
+    const auto* buffer = scratch.frontier.data();
+    
+    size_t bfs = 0;
+    size_t maxDepth = 0;
+    relations.ForEachDescendant([&](Entity, size_t depth, Position&) { ++bfs; maxDepth = std::max(maxDepth, depth); }, scratch);
+    EXPECT_EQ(bfs, total);
+    EXPECT_EQ(maxDepth, 4u);
+    
+    size_t dfs = 0;
+    relations.ForEachDescendant([&](Entity, size_t, Position&) { ++dfs; }, scratch, TraversalOrder::DepthFirst);
+    EXPECT_EQ(dfs, total);
+    EXPECT_EQ(scratch.frontier.data(), buffer);
+    
+    // Once the buffers have grown, traversals do not touch the heap, including those that
+    // borrow the per-thread scratch
+    for (auto entry : relations.GetDescendants())
+    {
+        (void)entry;
+    }
+    const size_t allocationsBefore = t_allocationCount;
+    
+    size_t visited = 0;
+    for (auto entry : relations.GetDescendants(&scratch))
+    {
+        (void)entry;
+        ++visited;
+    }
+    for (auto entry : relations.GetDescendants())
+    {
+        (void)entry;
+        ++visited;
+    }
+    auto leafRelations = registry->GetRelations<Position>(frontier.back());
+    for (auto entry : leafRelations.GetAncestors())
+    {
+        (void)entry;
+        ++visited;
+    }
+    relations.ForEachDescendant([&](Entity, size_t, Position&) { ++visited; }, scratch);
+    relations.ForEachDescendant([&](Entity, size_t, Position&) { ++visited; }, scratch, TraversalOrder::DepthFirst);
+    
+    EXPECT_EQ(t_allocationCount, allocationsBefore);
+    EXPECT_EQ(visited, total * 4 + 4);
+}
+
+// Nested and copied iterators each keep their own traversal state
+TEST_F(RelationsTest, NestedTraversals)
+{
+    Entity root = registry->CreateEntity();
+    Entity a = registry->CreateEntity();
+    Entity b = registry->CreateEntity();
+    Entity a1 = registry->CreateEntity();
+    Entity a2 = registry->CreateEntity();
+    registry->SetParent(a, root);
+    registry->SetParent(b, root);
+    registry->SetParent(a1, a);
+    registry->SetParent(a2, a);
+    
+    // Ranges point into their Relations, so both must outlive the loops
+    auto relations = registry->GetRelations(root);
+    size_t pairs = 0;
+    for (auto outer : relations.GetDescendants())
+    {
+        auto outerRelations = registry->GetRelations(outer.entity);
+        for (auto inner : outerRelations.GetAncestors())
+        {
+            (void)inner;
+            ++pairs;
+        }
+    }
+    
+    // a and b have one ancestor each, a1 and a2 have two
+    EXPECT_EQ(pairs, 6u);
+    
+    auto range = relations.GetDescendants();
+    auto it = range.begin();
+    auto copy = it;
+    ++it;
+    ++it;
+    EXPECT_EQ(copy->depth, 1u);
+    size_t remaining = 0;
+    for (; copy != range.end(); ++copy)
+    {
+        ++remaining;
+    }
+    EXPECT_EQ(remaining, 4u);
+}
+
+TEST_F(RelationsTest, FilteredChildrenGroupByArchetype)
+{
+    Entity parent = registry->CreateEntity();
+    std::vector<Entity> moving;
+    std::vector<Entity> still;
+    for (int i = 0; i < 12; ++i)
+    {
+        Entity child = registry->CreateEntityWith(Position(float(i), 0.0f, 0.0f));
+        if (i % 2 == 1)
+        {
+            registry->AddComponent<Velocity>(child);
+            moving.push_back(child);
+        }
+        else
+        {
+            still.push_back(child);
+        }
+        registry->SetParent(child, parent);
+    }
+    Entity unmatched = registry->CreateEntityWith(Health{});
+    registry->SetParent(unmatched, parent);
+    
+    // Children come grouped by archetype, in sibling order within a group
+    std::vector<Entity> visited;
+    auto relations = registry->GetRelations<Position>(parent);
+    relations.ForEachChild([&](Entity child, Position& pos)
+    {
+        visited.push_back(child);
+        pos.y = pos.x;
+    });
+    
+    std::vector<Entity> expected = still;
+    expected.insert(expected.end(), moving.begin(), moving.end());
+    EXPECT_EQ(visited, expected);
+    
+    for (Entity child : expected)
+    {
+        const Position* pos = registry->GetComponent<Position>(child);
+        EXPECT_FLOAT_EQ(pos->y, pos->x);
+    }
+    
+    // Multiple components are gathered from the same location
+    size_t count = 0;
+    registry->GetRelations<Position, Velocity>(parent).ForEachChild([&](Entity child, Position&, Velocity&)
+    {
+        EXPECT_EQ(child, moving[count]);
+        ++count;
+    });
+    EXPECT_EQ(count, moving.size());
+}
+
+TEST_F(RelationsTest, FilterCacheFollowsStructuralChanges)
+{
+    Entity parent = registry->CreateEntity();
+    Entity a = registry->CreateEntityWith(Position{});
+    Entity b = registry->CreateEntityWith(Position{});
+    Entity c = registry->CreateEntity();
+    registry->SetParent(a, parent);
+    registry->SetParent(b, parent);
+    registry->SetParent(c, parent);
+    
+    // One Relations object reused across changes, so its per-archetype cache must stay correct
+    auto relations = registry->GetRelations<Position, Not<Enemy>>(parent);
+    auto count = [&]()
+    {
+        size_t n = 0;
+        for (Entity child : relations.GetChildren())
+        {
+            (void)child;
+            ++n;
+        }
+        return n;
+    };
+    EXPECT_EQ(count(), 2u);
+    
+    // Moves into a brand new archetype
+    registry->AddComponent<Enemy>(a);
+    EXPECT_EQ(count(), 1u);
+    
+    // Moves into an archetype the cache already knows
+    registry->AddComponent<Position>(c);
+    EXPECT_EQ(count(), 2u);
+    
+    registry->RemoveComponent<Enemy>(a);
+    EXPECT_EQ(count(), 3u);
+    
+    // Removing empty archetypes frees addresses that later archetypes may reuse
+    registry->RemoveComponent<Position>(b);
+    Registry::DefragmentationOptions options;
+    options.minEmptyDuration = 0;
+    options.minArchetypesToKeep = 0;
+    registry->Defragment(options);
+    registry->AddComponent<Velocity>(b);
+    EXPECT_EQ(count(), 2u);
+    registry->AddComponent<Position>(b);
+    EXPECT_EQ(count(), 3u);
+}
@@ -134,6 +134,12 @@ TEST_F(RelationshipGraphSerializationTest, MultipleChildren)
         EXPECT_EQ(newGraph.GetParent(child1), parent);
         EXPECT_EQ(newGraph.GetParent(child2), parent);
         EXPECT_EQ(newGraph.GetParent(child3), parent);
+        
+        // Loaded children know their place in the list, so they can be removed again
+        newGraph.RemoveParent(child1);
+        newGraph.RemoveParent(child3);
+        ASSERT_EQ(newGraph.GetChildren(parent).size(), 1u);
+        EXPECT_EQ(newGraph.GetChildren(parent)[0], child2);
     }
 }
 
@@ -446,4 +446,284 @@ TEST_F(RelationshipGraphTest, InvalidEntityOperations)
     EXPECT_FALSE(graph->GetParent(valid).IsValid());
     EXPECT_EQ(graph->GetChildren(valid).size(), 0u);
     EXPECT_EQ(graph->GetLinks(valid).size(), 0u);
-}
\ No newline at end of file
+}
+
+// A new version of an ID must not see relationships of the old one
+TEST_F(RelationshipGraphTest, RecycledIDVersionsAreDistinct)
+{
+    Astra::Entity parent(1, 1);
+    Astra::Entity child(2, 1);
+    graph->SetParent(child, parent);
+    graph->AddLink(parent, Astra::Entity(3, 1));
+    
+    Astra::Entity recycledChild(2, 2);
+    EXPECT_FALSE(graph->HasParent(recycledChild));
+    EXPECT_TRUE(graph->GetChildren(Astra::Entity(1, 2)).empty());
+    EXPECT_FALSE(graph->AreLinked(Astra::Entity(1, 2), Astra::Entity(3, 1)));
+    
+    graph->OnEntityDestroyed(child);
+    graph->SetParent(recycledChild, parent);
+    ASSERT_EQ(graph->GetChildren(parent).size(), 1u);
+    EXPECT_EQ(graph->GetChildren(parent)[0], recycledChild);
+    EXPECT_EQ(graph->GetParentChildCount(), 1u);
+}
+
+// Slots are released once they hold no relationships, keeping counts exact
+TEST_F(RelationshipGraphTest, CountsTrackSlotRelease)
+{
+    auto entities = CreateEntities(1000);
+    for (size_t i = 1; i < entities.size(); ++i)
+    {
+        graph->SetParent(entities[i], entities[(i - 1) / 4]);
+    }
+    for (size_t i = 0; i + 1 < entities.size(); i += 2)
+    {
+        graph->AddLink(entities[i], entities[i + 1]);
+    }
+    
+    EXPECT_EQ(graph->GetParentChildCount(), 999u);
+    EXPECT_EQ(graph->GetParentCount(), 250u);
+    EXPECT_EQ(graph->GetLinkedEntityCount(), 1000u);
+    
+    for (auto entity : entities)
+    {
+        graph->OnEntityDestroyed(entity);
+    }
+    
+    EXPECT_EQ(graph->GetParentChildCount(), 0u);
+    EXPECT_EQ(graph->GetParentCount(), 0u);
+    EXPECT_EQ(graph->GetLinkedEntityCount(), 0u);
+    
+    // The graph is fully reusable afterwards
+    graph->SetParent(entities[999], entities[0]);
+    EXPECT_EQ(graph->GetParent(entities[999]), entities[0]);
+}
+
+// Removing a child swaps the parent's last child into its place, in constant time
+TEST_F(RelationshipGraphTest, RemoveChildrenInAnyOrder)
+{
+    auto entities = CreateEntities(4001);
+    const auto parent = entities[0];
+    for (size_t i = 1; i < entities.size(); ++i)
+    {
+        graph->SetParent(entities[i], parent);
+    }
+    
+    std::unordered_set<Astra::Entity::IDType> remaining;
+    for (size_t i = 1; i < entities.size(); ++i)
+    {
+        remaining.insert(entities[i].GetID());
+    }
+    
+    // Stride through the children so removals hit the front, middle and back of the list
+    for (size_t step = 0; step < 4000; ++step)
+    {
+        const auto child = entities[1 + (step * 997) % 4000];
+        graph->RemoveParent(child);
+        remaining.erase(child.GetID());
+        EXPECT_FALSE(graph->HasParent(child));
+        
+        if (step % 500 == 0)
+        {
+            const auto& children = graph->GetChildren(parent);
+            ASSERT_EQ(children.size(), remaining.size());
+            for (auto sibling : children)
+            {
+                ASSERT_EQ(remaining.count(sibling.GetID()), 1u);
+            }
+        }
+    }
+    
+    EXPECT_FALSE(graph->HasChildren(parent));
+    EXPECT_EQ(graph->GetParentChildCount(), 0u);
+    EXPECT_EQ(graph->GetParentCount(), 0u);
+}
+
+// Levels hold every hierarchy member exactly once, one level below its parent
+TEST_F(RelationshipGraphTest, LevelsOrderParentsFirst)
+{
+    auto entities = CreateEntities(10);
+    auto CheckLevels = [&](size_t expectedMembers)
+    {
+        const auto& levels = graph->GetLevels();
+        std::unordered_set<uint64_t> seen;
+        for (size_t depth = 0; depth < levels.size(); ++depth)
+        {
+            EXPECT_FALSE(levels[depth].empty());
+            for (auto entity : levels[depth])
+            {
+                EXPECT_TRUE(seen.insert(entity.GetValue()).second);
+                size_t ancestors = 0;
+                for (auto p = graph->GetParent(entity); p.IsValid(); p = graph->GetParent(p))
+                {
+                    ++ancestors;
+                }
+                EXPECT_EQ(ancestors, depth);
+            }
+        }
+        EXPECT_EQ(seen.size(), expectedMembers);
+    };
+    
+    // 0 -> 1 -> 2 -> 3, 0 -> 4
+    graph->SetParent(entities[1], entities[0]);
+    graph->SetParent(entities[2], entities[1]);
+    graph->SetParent(entities[3], entities[2]);
+    graph->SetParent(entities[4], entities[0]);
+    ASSERT_EQ(graph->GetLevels().size(), 4u);
+    CheckLevels(5);
+    
+    // Moving a subtree under a deeper parent shifts all of it
+    graph->SetParent(entities[1], entities[4]);
+    EXPECT_EQ(graph->GetLevels().size(), 5u);
+    CheckLevels(5);
+    
+    // Detaching a subtree makes it a separate root
+    graph->RemoveParent(entities[2]);
+    CheckLevels(5);
+    
+    // Removing a leaf drops it and its now childless root
+    graph->RemoveParent(entities[3]);
+    CheckLevels(3);
+    
+    graph->OnEntityDestroyed(entities[4]);
+    CheckLevels(0);
+    
+    // Members in a cycle have no depth
+    graph->SetParent(entities[6], entities[5]);
+    graph->SetParent(entities[5], entities[6]);
+    graph->SetParent(entities[8], entities[7]);
+    CheckLevels(2);
+}
+
+TEST_F(RelationshipGraphTest, CycleDetection)
+{
+    auto entities = CreateEntities(4);
+    graph->SetParent(entities[1], entities[0]);
+    graph->SetParent(entities[2], entities[1]);
+    graph->SetParent(entities[3], entities[1]);
+    EXPECT_FALSE(graph->HasCycles());
+    
+    // Reparenting a subtree elsewhere is fine
+    graph->SetParent(entities[2], entities[3]);
+    EXPECT_FALSE(graph->HasCycles());
+    
+    // 0 -> 1 -> 3 -> 2, closing 2 -> 0 forms a cycle
+    graph->SetParent(entities[0], entities[2]);
+    EXPECT_TRUE(graph->HasCycles());
+    
+    // Breaking it clears the flag once the levels are rebuilt
+    graph->RemoveParent(entities[0]);
+    graph->GetLevels();
+    EXPECT_FALSE(graph->HasCycles());
+}
+
+TEST_F(RelationshipGraphTest, LinkSnapshotStructure)
+{
+    auto entities = CreateEntities(6);
+    graph->AddLink(entities[0], entities[1]);
+    graph->AddLink(entities[1], entities[2]);
+    graph->AddLink(entities[4], entities[5]);
+    
+    const auto& snapshot = graph->BuildLinkSnapshot();
+    EXPECT_EQ(snapshot.VertexCount(), 5u);
+    EXPECT_EQ(snapshot.EdgeCount(), 6u);
+    EXPECT_EQ(snapshot.GetVertex(entities[3]), Astra::LinkSnapshot::INVALID_VERTEX);
+    
+    // Vertices follow entity ID order and neighbors map back to the linked entities
+    for (uint32_t v = 0; v < snapshot.VertexCount(); ++v)
+    {
+        Astra::Entity entity = snapshot.GetEntity(v);
+        EXPECT_EQ(snapshot.GetVertex(entity), v);
+        
+        auto links = graph->GetLinks(entity);
+        auto neighbors = snapshot.GetNeighbors(v);
+        ASSERT_EQ(neighbors.size(), links.size());
+        for (size_t i = 0; i < neighbors.size(); ++i)
+        {
+            EXPECT_EQ(snapshot.GetEntity(neighbors[i]), links[i]);
+        }
+    }
+    
+    // Unchanged links reuse the snapshot, a change rebuilds it
+    const Astra::Entity* before = snapshot.GetEntities().data();
+    EXPECT_EQ(graph->BuildLinkSnapshot().GetEntities().data(), before);
+    
+    graph->RemoveLink(entities[4], entities[5]);
+    EXPECT_EQ(graph->BuildLinkSnapshot().VertexCount(), 3u);
+    
+    graph->OnEntityDestroyed(entities[1]);
+    EXPECT_EQ(graph->BuildLinkSnapshot().VertexCount(), 0u);
+}
+
+TEST_F(RelationshipGraphTest, LinkSnapshotConnectedComponents)
+{
+    auto entities = CreateEntities(8);
+    graph->AddLink(entities[5], entities[0]);
+    graph->AddLink(entities[0], entities[3]);
+    graph->AddLink(entities[1], entities[7]);
+    graph->AddLink(entities[2], entities[6]);
+    graph->AddLink(entities[6], entities[7]);
+    
+    const auto& snapshot = graph->BuildLinkSnapshot();
+    std::vector<uint32_t> components;
+    EXPECT_EQ(snapshot.ConnectedComponents(components), 2u);
+    ASSERT_EQ(components.size(), 7u);
+    
+    auto label = [&](Astra::Entity e) { return components[snapshot.GetVertex(e)]; };
+    EXPECT_EQ(label(entities[0]), label(entities[3]));
+    EXPECT_EQ(label(entities[0]), label(entities[5]));
+    EXPECT_EQ(label(entities[1]), label(entities[2]));
+    EXPECT_EQ(label(entities[1]), label(entities[6]));
+    EXPECT_EQ(label(entities[1]), label(entities[7]));
+    EXPECT_NE(label(entities[0]), label(entities[1]));
+    
+    // Labels are numbered in order of each component's first vertex
+    EXPECT_EQ(label(entities[0]), 0u);
+    EXPECT_EQ(label(entities[1]), 1u);
+}
+
+TEST_F(RelationshipGraphTest, LinkSnapshotBreadthFirst)
+{
+    // Hub linked to a wide ring of spokes, large enough for the frontier to split across workers
+    constexpr size_t spokes = 20000;
+    auto entities = CreateEntities(spokes + 4);
+    for (size_t i = 1; i <= spokes; ++i)
+    {
+        graph->AddLink(entities[0], entities[i]);
+        graph->AddLink(entities[i], entities[i % spokes + 1]);
+    }
+    
+    // Tail hangs off a single spoke
+    graph->AddLink(entities[spokes], entities[spokes + 1]);
+    
+    // Separate pair never reached from the hub
+    graph->AddLink(entities[spokes + 2], entities[spokes + 3]);
+    
+    const auto& snapshot = graph->BuildLinkSnapshot();
+    ASSERT_EQ(snapshot.VertexCount(), spokes + 4);
+    
+    std::vector<uint32_t> distances;
+    const uint32_t hub = snapshot.GetVertex(entities[0]);
+    Astra::JobSystem jobs(Astra::JobSystem::Config{.workerCount = 3});
+    snapshot.BreadthFirst(std::span<const uint32_t>(&hub, 1), distances, &jobs);
+    EXPECT_EQ(distances[hub], 0u);
+    for (size_t i = 1; i <= spokes; ++i)
+    {
+        EXPECT_EQ(distances[snapshot.GetVertex(entities[i])], 1u);
+    }
+    EXPECT_EQ(distances[snapshot.GetVertex(entities[spokes + 1])], 2u);
+    EXPECT_EQ(distances[snapshot.GetVertex(entities[spokes + 2])], Astra::LinkSnapshot::UNREACHED);
+    
+    // Same distances on the calling thread alone
+    std::vector<uint32_t> sequential;
+    snapshot.BreadthFirst(std::span<const uint32_t>(&hub, 1), sequential);
+    EXPECT_EQ(sequential, distances);
+    
+    // From the tail the ring is two hops away through the spoke, everything else three
+    const uint32_t tail = snapshot.GetVertex(entities[spokes + 1]);
+    snapshot.BreadthFirst(std::span<const uint32_t>(&tail, 1), distances);
+    EXPECT_EQ(distances[snapshot.GetVertex(entities[spokes])], 1u);
+    EXPECT_EQ(distances[hub], 2u);
+    EXPECT_EQ(distances[snapshot.GetVertex(entities[1])], 2u);
+    EXPECT_EQ(distances[snapshot.GetVertex(entities[2])], 3u);
+}
@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
 #include <gtest/gtest.h>
 #include <numeric>
 #include <unordered_set>
@@ -417,4 +420,238 @@ TEST_F(ViewTest, ModificationDuringIteration)
         Position* pos = registry->GetComponent<Position>(entities[i]);
         EXPECT_EQ(pos->x, float(i * 2));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(ViewTest, QueryCacheSharedAcrossViews)
+{
+    using namespace Astra::Test;
+    auto& manager = registry->GetArchetypeManager();
+    
+    Astra::Entity a = registry->CreateEntityWith(Position{}, Velocity{});
+    
+    auto view = registry->CreateView<Position, Velocity>();
+    const size_t queries = manager.GetCachedQueryCount();
+    for (int i = 0; i < 3; ++i)
+    {
+        auto again = registry->CreateView<Position, Velocity>();
+        EXPECT_EQ(again.Size(), 1u);
+    }
+    EXPECT_EQ(manager.GetCachedQueryCount(), queries);
+    
+    // Archetypes created after the view are pushed into its list
+    Astra::Entity b = registry->CreateEntityWith(Position{}, Velocity{}, Health{});
+    registry->CreateEntityWith(Position{}, Health{});
+    EXPECT_EQ(view.Size(), 2u);
+    
+    std::vector<Astra::Entity> visited;
+    view.ForEach([&](Astra::Entity entity, Position&, Velocity&) { visited.push_back(entity); });
+    std::sort(visited.begin(), visited.end());
+    EXPECT_EQ(visited, (std::vector<Astra::Entity>{a, b}));
+    
+    // Emptied archetypes stay listed until removed, without being visited
+    registry->DestroyEntity(b);
+    EXPECT_EQ(view.Size(), 1u);
+    EXPECT_FALSE(view.Empty());
+    registry->DestroyEntity(a);
+    EXPECT_TRUE(view.Empty());
+    
+    Astra::Registry::DefragmentationOptions options;
+    options.minEmptyDuration = 0;
+    options.minArchetypesToKeep = 0;
+    registry->Defragment(options);
+    
+    size_t count = 0;
+    view.ForEach([&](Astra::Entity, Position&, Velocity&) { ++count; });
+    EXPECT_EQ(count, 0u);
+    
+    registry->CreateEntityWith(Position{}, Velocity{});
+    EXPECT_EQ(view.Size(), 1u);
+    auto fresh = registry->CreateView<Position, Velocity>();
+    EXPECT_EQ(fresh.Size(), 1u);
+}
+
+// Test chunk iteration with contiguous column spans
+TEST_F(ViewTest, ChunkIteration)
+{
+    using namespace Astra::Test;
+    
+    constexpr int ENTITY_COUNT = 20000;
+    for (int i = 0; i < ENTITY_COUNT; ++i)
+    {
+        if (i % 4 == 0)
+        {
+            registry->CreateEntityWith(Position{float(i), 0, 0}, Velocity{1, 0, 0}, Health{i, 100});
+        }
+        else
+        {
+            registry->CreateEntityWith(Position{float(i), 0, 0}, Velocity{1, 0, 0});
+        }
+    }
+    
+    auto view = registry->CreateView<Position, Velocity, Astra::Optional<Health>>();
+    
+    size_t entities = 0;
+    size_t withHealth = 0;
+    view.ForEachChunk([&](Astra::ChunkView<Position, Velocity, Astra::Optional<Health>> chunk)
+    {
+        auto positions = chunk.Get<Position>();
+        auto velocities = chunk.Get<Velocity>();
+        auto health = chunk.Get<Health>();
+        ASSERT_EQ(positions.size(), chunk.Size());
+        ASSERT_EQ(velocities.size(), chunk.Size());
+        ASSERT_EQ(chunk.GetEntities().size(), chunk.Size());
+        EXPECT_EQ(chunk.Has<Health>(), !health.empty());
+        
+        for (size_t i = 0; i < chunk.Size(); ++i)
+        {
+            EXPECT_EQ(&positions[i], registry->GetComponent<Position>(chunk.GetEntities()[i]));
+            if (!health.empty())
+            {
+                EXPECT_EQ(health[i].current, int(positions[i].x));
+            }
+        }
+        entities += chunk.Size();
+        withHealth += health.size();
+    });
+    EXPECT_EQ(entities, size_t(ENTITY_COUNT));
+    EXPECT_EQ(withHealth, size_t(ENTITY_COUNT / 4));
+    
+    std::atomic<size_t> visited{0};
+    view.ParallelForEachChunk([&](Astra::ChunkView<Position, Velocity, Astra::Optional<Health>> chunk)
+    {
+        auto positions = chunk.Get<Position>();
+        auto velocities = chunk.Get<Velocity>();
+        for (size_t i = 0; i < chunk.Size(); ++i)
+        {
+            positions[i].x += velocities[i].dx;
+        }
+        visited.fetch_add(chunk.Size(), std::memory_order_relaxed);
+    });
+    EXPECT_EQ(visited.load(), size_t(ENTITY_COUNT));
+    
+    view.ForEach([](Astra::Entity, Position& pos, Velocity&, Health* health)
+    {
+        if (health)
+        {
+            EXPECT_EQ(int(pos.x), health->current + 1);
+        }
+    });
+}
+
+// Test pack iteration with masked chunk tails
+TEST_F(ViewTest, SimdIteration)
+{
+    using namespace Astra::Test;
+    
+    constexpr int ENTITY_COUNT = 1003;  // Leaves a partial run at the end
+    for (int i = 0; i < ENTITY_COUNT; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            registry->CreateEntityWith(Position{float(i), 0, 0}, Velocity{2, 1, 0}, Health{});
+        }
+        else
+        {
+            registry->CreateEntityWith(Position{float(i), 0, 0}, Velocity{2, 1, 0});
+        }
+    }
+    
+    auto view = registry->CreateView<Position, Velocity, Astra::Optional<Health>>();
+    
+    size_t visited = 0;
+    size_t partialRuns = 0;
+    view.ForEachSimd<Astra::Simd::Width128>([&](std::span<const Astra::Entity> entities,
+        Astra::LaneView<Position, Astra::Simd::Width128> pos,
+        Astra::LaneView<Velocity, Astra::Simd::Width128> vel,
+        Astra::LaneView<Health, Astra::Simd::Width128> health)
+    {
+        EXPECT_EQ(entities.size(), pos.Count());
+        EXPECT_LE(pos.Count(), 4u);
+        partialRuns += pos.IsFull() ? 0 : 1;
+        
+        auto dx = vel.Load(&Velocity::dx);
+        pos.Store(&Position::x, pos.Load(&Position::x) + dx * dx);
+        pos.Store(&Position::y, pos.Load(&Position::y) + vel.Load(&Velocity::dy));
+        
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            EXPECT_EQ(&pos[i], registry->GetComponent<Position>(entities[i]));
+        }
+        EXPECT_EQ(health.IsValid(), registry->HasComponent<Health>(entities[0]));
+        visited += pos.Count();
+    });
+    EXPECT_EQ(visited, size_t(ENTITY_COUNT));
+    EXPECT_GT(partialRuns, 0u);
+    
+    // Inactive tail lanes are never written past the chunk
+    view.ForEach([](Astra::Entity, Position& pos, Velocity&, Health*)
+    {
+        EXPECT_EQ(pos.y, 1.0f);
+        EXPECT_EQ(std::fmod(pos.x, 1.0f), 0.0f);
+    });
+    
+    auto pack = Astra::Simd::Pack<float, Astra::Simd::Width256>::Broadcast(3.0f);
+    pack = Max(pack * pack, Astra::Simd::Pack<float, Astra::Simd::Width256>::Broadcast(10.0f));
+    float out[8] = {};
+    pack.StorePartial(out, 5);
+    EXPECT_EQ(out[4], 10.0f);
+    EXPECT_EQ(out[5], 0.0f);
+}
+
+// Test parallel reductions give the same result for any thread count
+TEST_F(ViewTest, ParallelReduce)
+{
+    using namespace Astra::Test;
+    
+    constexpr int ENTITY_COUNT = 20000;
+    for (int i = 0; i < ENTITY_COUNT; ++i)
+    {
+        // Mixed magnitudes make the float sum depend on the combine order
+        const float x = (i % 3 == 0) ? 1.0e6f + float(i) : 0.1f * float(i);
+        if (i % 4 == 0)
+        {
+            registry->CreateEntityWith(Position{x, 0, 0}, Velocity{1, 0, 0}, Health{i, 100});
+        }
+        else
+        {
+            registry->CreateEntityWith(Position{x, 0, 0}, Velocity{1, 0, 0});
+        }
+    }
+    
+    // Views pick up the registry's job system when they are created
+    auto sumX = [this]()
+    {
+        auto view = registry->CreateView<const Position, Astra::Optional<Health>>();
+        return view.ParallelReduce(0.0f,
+            [](float& sum, Astra::Entity, const Position& pos, Health*) { sum += pos.x; },
+            [](float a, float b) { return a + b; });
+    };
+    
+    const float reference = sumX();
+    auto view = registry->CreateView<const Position, Astra::Optional<Health>>();
+    double exact = 0.0;
+    view.ForEach([&exact](Astra::Entity, const Position& pos, Health*) { exact += pos.x; });
+    EXPECT_NEAR(reference, exact, exact * 1e-5);
+    
+    for (size_t workers : {1u, 3u, 7u})
+    {
+        registry->SetJobSystem(std::make_shared<Astra::JobSystem>(Astra::JobSystem::Config{workers}));
+        EXPECT_EQ(sumX(), reference) << workers << " workers";
+    }
+    
+    const size_t withHealth = view.ParallelTransformReduce(size_t(0),
+        [](Astra::Entity, const Position&, Health* health) { return size_t(health != nullptr); },
+        std::plus<>{});
+    EXPECT_EQ(withHealth, size_t(ENTITY_COUNT / 4));
+    
+    // Small views take the sequential path with the same per-chunk accumulators
+    for (int i = 0; i < 50; ++i)
+    {
+        registry->CreateEntityWith(Health{i * 3, 100});
+    }
+    auto health = registry->CreateView<const Health, Astra::Not<Position>>();
+    const int maxHealth = health.ParallelTransformReduce(0,
+        [](Astra::Entity, const Health& h) { return h.current; },
+        [](int a, int b) { return std::max(a, b); });
+    EXPECT_EQ(maxHealth, 49 * 3);
+}
@@ -425,6 +425,41 @@ TEST_F(BinarySerializationTests, ErrorHandling)
     }
 }
 
+TEST_F(BinarySerializationTests, EntityWidthMismatch)
+{
+    using namespace Astra;
+    
+    std::vector<std::byte> buffer;
+    {
+        BinaryWriter writer(buffer);
+        BinaryHeader header;
+        EXPECT_EQ(header.entityBits, ENTITY_BITS);
+        writer.WriteHeader(header);
+    }
+    
+    // Archive written with the other handle width must be rejected
+    {
+        BinaryHeader header;
+        std::memcpy(&header, buffer.data(), sizeof(BinaryHeader));
+        header.entityBits = ENTITY_BITS == 64 ? 32 : 64;
+        std::vector<std::byte> patched = buffer;
+        std::memcpy(patched.data(), &header, sizeof(BinaryHeader));
+        
+        BinaryReader reader(patched);
+        auto result = reader.ReadHeader();
+        EXPECT_TRUE(result.IsErr());
+        EXPECT_EQ(*result.GetError(), SerializationError::EntityWidthMismatch);
+    }
+    
+    // Legacy archives leave the field zeroed and were always 32-bit
+    {
+        BinaryHeader header;
+        std::memcpy(&header, buffer.data(), sizeof(BinaryHeader));
+        header.entityBits = 0;
+        EXPECT_EQ(header.IsEntityWidthCompatible(), ENTITY_BITS == 32);
+    }
+}
+
 TEST_F(BinarySerializationTests, LargeDataSerialization)
 {
     using namespace Astra;
@@ -1001,6 +1036,117 @@ TEST_F(BinarySerializationTests, ChecksumDisabled)
     }
 }
 
+TEST_F(BinarySerializationTests, Crc32cKernels)
+{
+    using namespace Astra;
+    
+    // Standard CRC-32C check value
+    const char* check = "123456789";
+    EXPECT_EQ(Checksum::CRC32(check, 9), 0xE3069283u);
+    EXPECT_EQ(Simd::Dispatch::Detail::Crc32cScalar(check, 9, 0), 0xE3069283u);
+    
+    // The dispatched kernel matches the portable one for any length and split point
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    for (size_t size : {0u, 1u, 7u, 8u, 9u, 63u, 1000u})
+    {
+        EXPECT_EQ(Checksum::CRC32(data.data(), size), Simd::Dispatch::Detail::Crc32cScalar(data.data(), size, 0));
+    }
+    
+    const uint32_t whole = Checksum::CRC32(data.data(), data.size());
+    EXPECT_EQ(Checksum::CRC32(data.data() + 333, data.size() - 333, Checksum::CRC32(data.data(), 333)), whole);
+    
+    // Feature detection is stable across calls
+    EXPECT_EQ(&GetCpuFeatures(), &GetCpuFeatures());
+}
+
+TEST_F(BinarySerializationTests, LegacyChecksumForV2Archives)
+{
+    using namespace Astra;
+    
+    std::vector<int> data(257);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<int>(i * 7919);
+    }
+    
+    std::vector<std::byte> buffer;
+    {
+        BinaryWriter writer(buffer);
+        BinaryHeader header;
+        writer.WriteHeader(header);
+        writer(data);
+        writer.FinalizeHeader();
+    }
+    
+    // Rewrite the header as a v2 archive. The legacy checksum does not chain like a CRC, so it
+    // is built from the same writes a v2 writer made: the element count, then the elements
+    BinaryHeader header;
+    std::memcpy(&header, buffer.data(), sizeof(BinaryHeader));
+    const uint32_t crc32c = header.dataChecksum;
+    const size_t count = data.size();
+    const uint32_t legacy = Checksum::LegacyCRC32(data.data(), data.size() * sizeof(int), Checksum::LegacyCRC32(&count, sizeof(count)));
+    ASSERT_NE(legacy, crc32c);
+    
+    auto readWith = [&buffer, &header](uint16_t version, uint32_t checksum)
+    {
+        header.version = version;
+        header.dataChecksum = checksum;
+        std::memcpy(buffer.data(), &header, sizeof(BinaryHeader));
+        
+        BinaryReader reader(buffer);
+        EXPECT_TRUE(reader.ReadHeader().IsOk());
+        std::vector<int> readData;
+        reader(readData);
+        return std::make_pair(readData, reader.VerifyChecksum().IsOk());
+    };
+    
+    auto [v2Data, v2Ok] = readWith(2, legacy);
+    EXPECT_EQ(v2Data, data);
+    EXPECT_TRUE(v2Ok);
+    
+    // The reader picks the checksum by version, not by trying both
+    EXPECT_FALSE(readWith(2, crc32c).second);
+    EXPECT_FALSE(readWith(3, legacy).second);
+    EXPECT_TRUE(readWith(3, crc32c).second);
+    
+    // A corrupted v2 payload is still caught
+    buffer.back() ^= std::byte{0x01};
+    EXPECT_FALSE(readWith(2, legacy).second);
+}
+
+// A v1 archive as baseline x86 builds wrote it, holding std::vector<int>{1, -2, 300, 40000, 123456789}
+TEST_F(BinarySerializationTests, ReadsV1ArchiveFixture)
+{
+    using namespace Astra;
+    
+#if defined(ASTRA_HAS_ARM_CRC32)
+    GTEST_SKIP() << "Builds with the ARM crc32 extension wrote v1 checksums with it";
+#endif
+    
+    const uint8_t fixture[] = {
+        0x41, 0x53, 0x54, 0x52, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x69, 0x66, 0xFE, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+        0x2C, 0x01, 0x00, 0x00, 0x40, 0x9C, 0x00, 0x00, 0x15, 0xCD, 0x5B, 0x07
+    };
+    std::vector<std::byte> buffer(sizeof(fixture));
+    std::memcpy(buffer.data(), fixture, sizeof(fixture));
+    
+    BinaryReader reader(buffer);
+    auto header = reader.ReadHeader();
+    ASSERT_TRUE(header.IsOk());
+    EXPECT_EQ(header.GetValue()->version, 1u);
+    
+    std::vector<int> data;
+    reader(data);
+    EXPECT_EQ(data, (std::vector<int>{1, -2, 300, 40000, 123456789}));
+    EXPECT_TRUE(reader.VerifyChecksum().IsOk());
+}
+
 TEST_F(BinarySerializationTests, FileChecksumVerification)
 {
     using namespace Astra;
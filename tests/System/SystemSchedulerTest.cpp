@@ -0,0 +1,684 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "../TestComponents.hpp"
+#include "Astra/Registry/Registry.hpp"
+#include "Astra/System/SystemScheduler.hpp"
+
+using namespace Astra;
+using namespace Astra::Test;
+
+namespace
+{
+    struct FrameTime
+    {
+        float delta = 0.0f;
+    };
+    
+    struct Settings
+    {
+        float gravity = -9.8f;
+    };
+    
+    struct ReadTimeA : SystemTraits<Reads<Position>, ReadsResources<FrameTime>>
+    {
+        void operator()(Registry&) {}
+    };
+    
+    struct ReadTimeB : SystemTraits<Reads<Velocity>, ReadsResources<FrameTime>>
+    {
+        void operator()(Registry&) {}
+    };
+    
+    struct AdvanceTime : SystemTraits<WritesResources<FrameTime>>
+    {
+        void operator()(Registry& registry)
+        {
+            registry.GetResource<FrameTime>()->delta += 1.0f;
+        }
+    };
+    
+    struct ReadSettings : SystemTraits<ReadsResources<Settings>>
+    {
+        void operator()(Registry&) {}
+    };
+    
+    // No traits, so it must wait for everything registered before it
+    struct SnapshotTime
+    {
+        void operator()(Registry& registry)
+        {
+            registry.GetResource<Settings>()->gravity = registry.GetResource<FrameTime>()->delta;
+        }
+    };
+}
+
+TEST(SystemSchedulerTest, ResourceAccessDrivesGrouping)
+{
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ReadTimeA>();
+    scheduler.AddSystem<ReadTimeB>();
+    scheduler.AddSystem<AdvanceTime>();
+    scheduler.AddSystem<ReadSettings>();
+    
+    // Shared reads run together and the writer waits for them; a resource-only system is not
+    // treated as unhinted, so ReadSettings joins the readers' group
+    const auto& plan = scheduler.GetExecutionPlan();
+    ASSERT_EQ(plan.size(), 2u);
+    EXPECT_EQ(plan[0], (std::vector<size_t>{0, 1, 3}));
+    EXPECT_EQ(plan[1], (std::vector<size_t>{2}));
+    
+    Registry registry;
+    registry.SetResource<FrameTime>();
+    scheduler.Execute(registry);
+    scheduler.Execute(registry);
+    EXPECT_FLOAT_EQ(registry.GetResource<FrameTime>()->delta, 2.0f);
+}
+
+TEST(SystemSchedulerTest, JobSystemExecutorRunsEveryGroup)
+{
+    Registry registry;
+    registry.SetResource<FrameTime>();
+    registry.SetResource<Settings>();
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ReadTimeA>();
+    scheduler.AddSystem<ReadTimeB>();
+    scheduler.AddSystem<AdvanceTime>();
+    scheduler.AddSystem<ReadSettings>();
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 2});
+    JobSystemExecutor executor(jobs);
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        scheduler.Execute(registry, &executor);
+    }
+    EXPECT_EQ(registry.GetResource<FrameTime>()->delta, 3.0f);
+}
+
+TEST(SystemSchedulerTest, DependencyGraphKeepsDirectEdges)
+{
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ReadTimeA>();
+    scheduler.AddSystem<ReadTimeB>();
+    scheduler.AddSystem<AdvanceTime>();
+    scheduler.AddSystem<ReadSettings>();
+    scheduler.AddSystem<SnapshotTime>();
+    
+    const auto& graph = scheduler.GetDependencyGraph();
+    ASSERT_EQ(graph.Size(), 5u);
+    
+    // The writer waits for both readers; the unhinted system waits for everything, but its
+    // edges from the readers are implied by the writer and left out
+    const std::vector<size_t> expectedRoots{0, 1, 3};
+    EXPECT_EQ(graph.roots, expectedRoots);
+    const std::vector<size_t> expectedPredecessors{0, 0, 2, 0, 2};
+    EXPECT_EQ(graph.predecessorCounts, expectedPredecessors);
+    const std::vector<size_t> expectedPaths{3, 3, 2, 2, 1};
+    EXPECT_EQ(graph.criticalPath, expectedPaths);
+    EXPECT_EQ(graph.successors[0], std::vector<size_t>{2});
+    EXPECT_EQ(graph.successors[2], std::vector<size_t>{4});
+    EXPECT_EQ(graph.successors[3], std::vector<size_t>{4});
+    EXPECT_TRUE(graph.successors[4].empty());
+}
+
+TEST(SystemSchedulerTest, JobSystemExecutorFollowsDependencies)
+{
+    Registry registry;
+    registry.SetResource<FrameTime>();
+    registry.SetResource<Settings>();
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ReadTimeA>();
+    scheduler.AddSystem<AdvanceTime>();
+    scheduler.AddSystem<ReadTimeB>();
+    scheduler.AddSystem<ReadSettings>();
+    scheduler.AddSystem<SnapshotTime>();
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 3});
+    JobSystemExecutor executor(jobs);
+    for (int frame = 1; frame <= 50; ++frame)
+    {
+        scheduler.Execute(registry, &executor);
+        ASSERT_EQ(registry.GetResource<Settings>()->gravity, static_cast<float>(frame));
+    }
+}
+
+namespace
+{
+    // Access comes from the declared view, not from traits
+    struct IntegrateVelocity
+    {
+        using Query = View<Position, const Velocity>;
+        
+        void operator()(Registry& registry)
+        {
+            registry.CreateView<Position, const Velocity>().ForEach([](Entity, Position& pos, const Velocity& vel)
+            {
+                pos.x += vel.dx;
+            });
+        }
+    };
+    
+    // Access comes from the view the scheduler injects
+    struct DampVelocity
+    {
+        void operator()(Registry&, View<Velocity, Not<Health>>& view)
+        {
+            view.ForEach([](Entity, Velocity& vel) { vel.dx *= 0.5f; });
+        }
+    };
+}
+
+TEST(SystemSchedulerTest, AccessInferredFromViews)
+{
+    SystemScheduler scheduler;
+    scheduler.AddSystem<IntegrateVelocity>();
+    scheduler.AddSystem<DampVelocity>();
+    scheduler.AddSystem([](Registry&, View<const Velocity, Optional<Health>>& view)
+    {
+        view.ForEach([](Entity, const Velocity&, Health*) {});
+    });
+    scheduler.AddSystem([](Registry&, View<const Position>& view)
+    {
+        view.ForEach([](Entity, const Position&) {});
+    });
+    
+    // Velocity is read by the first, written by the second and read by the third; the position
+    // reader only waits for the integrator, and Not<Health> is not an access
+    const auto& plan = scheduler.GetExecutionPlan();
+    ASSERT_EQ(plan.size(), 3u);
+    EXPECT_EQ(plan[0], std::vector<size_t>{0});
+    EXPECT_EQ(plan[1], (std::vector<size_t>{1, 3}));
+    EXPECT_EQ(plan[2], std::vector<size_t>{2});
+    
+    const auto& graph = scheduler.GetDependencyGraph();
+    const std::vector<size_t> expectedPredecessors{0, 1, 1, 1};
+    EXPECT_EQ(graph.predecessorCounts, expectedPredecessors);
+    
+    Registry registry;
+    Entity entity = registry.CreateEntity();
+    registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+    registry.AddComponent<Velocity>(entity, 2.0f, 0.0f, 0.0f);
+    scheduler.Execute(registry);
+    scheduler.Execute(registry);
+    EXPECT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 3.0f);
+    EXPECT_FLOAT_EQ(registry.GetComponent<Velocity>(entity)->dx, 0.5f);
+}
+
+TEST(SystemSchedulerTest, DisjointArchetypesRunInParallel)
+{
+    Registry registry;
+    Entity player = registry.CreateEntity();
+    registry.AddComponent<Position>(player, 0.0f, 0.0f, 0.0f);
+    registry.AddComponent<Player>(player);
+    Entity enemy = registry.CreateEntity();
+    registry.AddComponent<Position>(enemy, 0.0f, 0.0f, 0.0f);
+    registry.AddComponent<Enemy>(enemy);
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem([](Registry&, View<Position, const Player>& view)
+    {
+        view.ForEach([](Entity, Position& pos, const Player&) { pos.x += 1.0f; });
+    });
+    scheduler.AddSystem([](Registry&, View<Position, const Enemy>& view)
+    {
+        view.ForEach([](Entity, Position& pos, const Enemy&) { pos.x -= 1.0f; });
+    });
+    
+    // Both write Position, but never in the same archetype
+    EXPECT_EQ(scheduler.GetExecutionPlan().size(), 2u);
+    ASSERT_EQ(scheduler.GetExecutionPlan(registry).size(), 1u);
+    EXPECT_EQ(scheduler.GetDependencyGraph(registry).roots.size(), 2u);
+    
+    scheduler.SetArchetypeAccessValidation(true);
+    scheduler.Execute(registry);
+    EXPECT_TRUE(scheduler.GetArchetypeAccessViolations().empty());
+    EXPECT_FLOAT_EQ(registry.GetComponent<Position>(player)->x, 1.0f);
+    EXPECT_FLOAT_EQ(registry.GetComponent<Position>(enemy)->x, -1.0f);
+    
+    // An archetype both queries match puts them back in order
+    Entity both = registry.CreateEntity();
+    registry.AddComponent<Position>(both, 0.0f, 0.0f, 0.0f);
+    registry.AddComponent<Player>(both);
+    registry.AddComponent<Enemy>(both);
+    EXPECT_EQ(scheduler.GetExecutionPlan(registry).size(), 2u);
+}
+
+namespace
+{
+    // Iterates players but writes Health on whoever it targets through the registry
+    struct HealTargets : SystemTraits<Reads<Position>, Writes<Health>>
+    {
+        using Query = View<const Position, const Player>;
+        
+        explicit HealTargets(Entity target) : target(target) {}
+        
+        void operator()(Registry& registry)
+        {
+            registry.GetComponent<Health>(target)->current += 10;
+        }
+        
+        Entity target;
+    };
+}
+
+TEST(SystemSchedulerTest, TraitAccessOutsideQueryKeepsConflict)
+{
+    Registry registry;
+    Entity player = registry.CreateEntityWith(Position{}, Player{});
+    Entity enemy = registry.CreateEntityWith(Health{}, Enemy{});
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<HealTargets>(enemy);
+    scheduler.AddSystem([](Registry&, View<Health, const Enemy>& view)
+    {
+        view.ForEach([](Entity, Health& health, const Enemy&) { health.current /= 2; });
+    });
+    
+    // The queries never share an archetype, but Health is written outside the first one
+    ASSERT_EQ(scheduler.GetExecutionPlan(registry).size(), 2u);
+    EXPECT_EQ(scheduler.GetDependencyGraph(registry).roots.size(), 1u);
+    
+    scheduler.Execute(registry);
+    EXPECT_EQ(registry.GetComponent<Health>(enemy)->current, 55);
+    EXPECT_TRUE(registry.IsValid(player));
+}
+
+TEST(SystemSchedulerTest, ArchetypeAccessValidationCatchesNewOverlap)
+{
+    Registry registry;
+    Entity player = registry.CreateEntity();
+    registry.AddComponent<Position>(player, 0.0f, 0.0f, 0.0f);
+    registry.AddComponent<Player>(player);
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem([](Registry& reg, View<Position, const Player>&)
+    {
+        // Structural change during the frame creates an archetype the other query matches
+        Entity both = reg.CreateEntity();
+        reg.AddComponent<Position>(both, 0.0f, 0.0f, 0.0f);
+        reg.AddComponent<Player>(both);
+        reg.AddComponent<Enemy>(both);
+    });
+    scheduler.AddSystem([](Registry&, View<Position, const Enemy>&) {});
+    
+    scheduler.SetArchetypeAccessValidation(true);
+    scheduler.Execute(registry);
+    ASSERT_EQ(scheduler.GetArchetypeAccessViolations().size(), 1u);
+    EXPECT_EQ(scheduler.GetArchetypeAccessViolations()[0], (std::pair<size_t, size_t>{0, 1}));
+    
+    // The next frame plans with the new archetype and keeps them apart
+    scheduler.Execute(registry);
+    EXPECT_TRUE(scheduler.GetArchetypeAccessViolations().empty());
+    EXPECT_EQ(scheduler.GetExecutionPlan(registry).size(), 2u);
+}
+
+namespace
+{
+    struct ChunkIntegrate
+    {
+        void operator()(ChunkView<Position, const Velocity> chunk)
+        {
+            auto positions = chunk.Get<Position>();
+            auto velocities = chunk.Get<const Velocity>();
+            for (size_t i = 0; i < chunk.Size(); ++i)
+            {
+                positions[i].x += velocities[i].dx;
+            }
+        }
+    };
+}
+
+TEST(SystemSchedulerTest, ChunkLocalSystemsPipelinePerChunk)
+{
+    Registry registry;
+    std::vector<Entity> moving;
+    for (int i = 0; i < 5000; ++i)
+    {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+        registry.AddComponent<Velocity>(entity, 1.0f, 0.0f, 0.0f);
+        moving.push_back(entity);
+    }
+    for (int i = 0; i < 3000; ++i)
+    {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+    }
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ChunkIntegrate>();
+    scheduler.AddSystem([](ChunkView<Position> chunk)
+    {
+        for (Position& pos : chunk.Get<Position>())
+        {
+            pos.x *= 2.0f;
+        }
+    });
+    scheduler.AddSystem([](ChunkView<const Position, Optional<Velocity>> chunk)
+    {
+        // Reads the doubled position of its own rows only
+        auto velocities = chunk.Get<Velocity>();
+        auto positions = chunk.Get<const Position>();
+        for (size_t i = 0; i < velocities.size(); ++i)
+        {
+            velocities[i].dy = positions[i].x;
+        }
+    });
+    // Not chunk-local, waits for every chunk of the systems before it
+    scheduler.AddSystem([](Registry& reg, View<const Velocity>& view)
+    {
+        float sum = 0.0f;
+        view.ForEach([&sum](Entity, const Velocity& vel) { sum += vel.dy; });
+        reg.SetResource<FrameTime>(FrameTime{sum});
+    });
+    
+    // Chunk-local systems keep plain component-level ordering in the plan
+    EXPECT_EQ(scheduler.GetExecutionPlan().size(), 4u);
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 3});
+    JobSystemExecutor executor(jobs);
+    scheduler.Execute(registry, &executor);
+    
+    for (Entity entity : moving)
+    {
+        ASSERT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 2.0f);
+        ASSERT_FLOAT_EQ(registry.GetComponent<Velocity>(entity)->dy, 2.0f);
+    }
+    EXPECT_FLOAT_EQ(registry.GetResource<FrameTime>()->delta, 10000.0f);
+    
+    // The sequential executor runs the same systems chunk by chunk in one pass each
+    scheduler.Execute(registry);
+    EXPECT_FLOAT_EQ(registry.GetComponent<Position>(moving[0])->x, 6.0f);
+    EXPECT_FLOAT_EQ(registry.GetResource<FrameTime>()->delta, 30000.0f);
+}
+
+TEST(SystemSchedulerTest, ChunkLocalSystemAfterDestroyingSystem)
+{
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4000; ++i)
+    {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+        registry.AddComponent<Velocity>(entity, 1.0f, 0.0f, 0.0f);
+        entities.push_back(entity);
+    }
+    
+    auto countChunks = [&registry]()
+    {
+        size_t chunks = 0;
+        registry.CreateView<Position, Velocity>().ForEachChunk([&chunks](ChunkView<Position, Velocity>) { ++chunks; });
+        return chunks;
+    };
+    const size_t chunksBefore = countChunks();
+    
+    // Frees the trailing chunks before the chunk-local system runs
+    SystemScheduler scheduler;
+    scheduler.AddSystem([&entities](Registry& reg, View<Position>&)
+    {
+        for (size_t i = 1000; i < entities.size(); ++i)
+        {
+            reg.DestroyEntity(entities[i]);
+        }
+    });
+    std::atomic<size_t> visited{0};
+    scheduler.AddSystem([&visited](ChunkView<Position, const Velocity> chunk)
+    {
+        visited.fetch_add(1, std::memory_order_relaxed);
+        for (Position& pos : chunk.Get<Position>())
+        {
+            pos.x += 1.0f;
+        }
+    });
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 3});
+    JobSystemExecutor executor(jobs);
+    scheduler.Execute(registry, &executor);
+    
+    // Only the chunks that are left are visited
+    EXPECT_LT(countChunks(), chunksBefore);
+    EXPECT_EQ(visited.load(), countChunks());
+    EXPECT_EQ(registry.Size(), 1000u);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        ASSERT_FLOAT_EQ(registry.GetComponent<Position>(entities[i])->x, 1.0f);
+    }
+}
+
+TEST(SystemSchedulerTest, ChunkLocalSystemAfterSpawningSystem)
+{
+    // Both executors must see the rows spawned ahead of the chunk-local system
+    auto run = [](ISystemExecutor* executor)
+    {
+        Registry registry;
+        for (int i = 0; i < 100; ++i)
+        {
+            Entity entity = registry.CreateEntity();
+            registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+            registry.AddComponent<Velocity>(entity, 1.0f, 0.0f, 0.0f);
+        }
+        
+        SystemScheduler scheduler;
+        scheduler.AddSystem([](Registry& reg, View<Position>&)
+        {
+            for (int i = 0; i < 3000; ++i)
+            {
+                Entity entity = reg.CreateEntity();
+                reg.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+                reg.AddComponent<Velocity>(entity, 1.0f, 0.0f, 0.0f);
+            }
+        });
+        scheduler.AddSystem<ChunkIntegrate>();
+        
+        if (executor)
+            scheduler.Execute(registry, executor);
+        else
+            scheduler.Execute(registry);
+        
+        size_t moved = 0;
+        registry.CreateView<const Position>().ForEach([&moved](Entity, const Position& pos)
+        {
+            moved += pos.x == 1.0f ? 1 : 0;
+        });
+        return moved;
+    };
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 3});
+    JobSystemExecutor executor(jobs);
+    EXPECT_EQ(run(nullptr), 3100u);
+    EXPECT_EQ(run(&executor), 3100u);
+}
+
+TEST(SystemSchedulerTest, ChunkLocalSystemAfterDefragment)
+{
+    Registry registry;
+    std::vector<Entity> kept;
+    std::vector<Entity> doomed;
+    for (int i = 0; i < 2000; ++i)
+    {
+        kept.push_back(registry.CreateEntityWith(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}));
+        doomed.push_back(registry.CreateEntityWith(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}, Health{}));
+    }
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ChunkIntegrate>();
+    
+    JobSystem jobs(JobSystem::Config{.workerCount = 3});
+    JobSystemExecutor executor(jobs);
+    scheduler.Execute(registry, &executor);
+    
+    // Destroys the emptied archetype without creating one, so the generation stays put
+    for (Entity entity : doomed)
+    {
+        registry.DestroyEntity(entity);
+    }
+    Registry::DefragmentationOptions options;
+    options.minEmptyDuration = 0;
+    options.minArchetypesToKeep = 0;
+    ASSERT_GT(registry.Defragment(options).archetypesRemoved, 0u);
+    
+    // Both executors must plan again instead of walking the destroyed archetype
+    scheduler.Execute(registry, &executor);
+    scheduler.Execute(registry);
+    for (Entity entity : kept)
+    {
+        ASSERT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 3.0f);
+    }
+}
+
+TEST(SystemSchedulerTest, ExecutionContextReusedAcrossFrames)
+{
+    struct RecordingExecutor : ISystemExecutor
+    {
+        const SystemExecutionContext* context = nullptr;
+        const void* systems = nullptr;
+        size_t chunkCount = 0;
+        
+        void Execute(const SystemExecutionContext& ctx) override
+        {
+            context = &ctx;
+            systems = ctx.systems.data();
+            chunkCount = ctx.chunks.size();
+            SequentialExecutor().Execute(ctx);
+        }
+    };
+    
+    Registry registry;
+    std::vector<Entity> entities;
+    entities.push_back(registry.CreateEntityWith(Position{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}));
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ChunkIntegrate>();
+    
+    RecordingExecutor executor;
+    scheduler.Execute(registry, &executor);
+    const SystemExecutionContext* context = executor.context;
+    const void* systems = executor.systems;
+    EXPECT_EQ(executor.chunkCount, 1u);
+    
+    // More chunks in the same archetype keep the plan, only the chunk list is refreshed
+    for (int i = 0; i < 5000; ++i)
+    {
+        entities.push_back(registry.CreateEntityWith(Position{1.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}));
+    }
+    scheduler.Execute(registry, &executor);
+    EXPECT_EQ(executor.context, context);
+    EXPECT_EQ(executor.systems, systems);
+    EXPECT_GT(executor.chunkCount, 1u);
+    
+    for (Entity entity : entities)
+    {
+        ASSERT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 2.0f);
+    }
+}
+
+TEST(SystemSchedulerTest, ChunkLocalSystemsOverSameArchetypesAreFused)
+{
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 2000; ++i)
+    {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+        registry.AddComponent<Velocity>(entity, 3.0f, 0.0f, 0.0f);
+        entities.push_back(entity);
+    }
+    
+    SystemScheduler scheduler;
+    scheduler.AddSystem<ChunkIntegrate>();
+    scheduler.AddSystem([](ChunkView<Position, const Velocity> chunk)
+    {
+        for (Position& pos : chunk.Get<Position>())
+        {
+            pos.x = std::min(pos.x, 4.0f);
+        }
+    });
+    scheduler.AddSystem([](ChunkView<Velocity, const Position> chunk)
+    {
+        for (Velocity& vel : chunk.Get<Velocity>())
+        {
+            vel.dx *= 0.5f;
+        }
+    });
+    // Matches the same archetypes but is not chunk-local, so it ends the fused run
+    scheduler.AddSystem([](Registry&, View<const Position, const Velocity>&) {});
+    
+    const auto& plan = scheduler.GetExecutionPlan(registry);
+    ASSERT_EQ(plan.size(), 2u);
+    const auto& units = scheduler.GetExecutionUnits();
+    ASSERT_EQ(units.size(), 2u);
+    EXPECT_EQ(units[0], (std::vector<size_t>{0, 1, 2}));
+    EXPECT_EQ(units[1], std::vector<size_t>{3});
+    
+    // Same results as running the three systems one after the other
+    scheduler.Execute(registry);
+    JobSystem jobs(JobSystem::Config{.workerCount = 2});
+    JobSystemExecutor executor(jobs);
+    scheduler.Execute(registry, &executor);
+    for (Entity entity : entities)
+    {
+        ASSERT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 4.0f);
+        ASSERT_FLOAT_EQ(registry.GetComponent<Velocity>(entity)->dx, 0.75f);
+    }
+    
+    scheduler.SetSystemFusion(false);
+    EXPECT_EQ(scheduler.GetExecutionPlan(registry).size(), 4u);
+}
+
+TEST(SystemSchedulerTest, FusedSystemsKeepTheirOwnQueries)
+{
+    // Archetypes created mid-frame match only one of the fused systems: a Position-only one
+    // just the first, and a Static one just the second
+    auto run = [](ISystemExecutor* executor)
+    {
+        Registry registry;
+        std::vector<Entity> moving;
+        for (int i = 0; i < 1000; ++i)
+        {
+            // Created with both components at once, so no Position-only archetype exists yet
+            moving.push_back(registry.CreateEntityWith(Position{0.0f, 0.0f, 0.0f}, Velocity{2.0f, 0.0f, 0.0f}));
+        }
+        
+        Entity still;
+        Entity frozen;
+        SystemScheduler scheduler;
+        scheduler.AddSystem([&still, &frozen](Registry& reg, View<Position>&)
+        {
+            still = reg.CreateEntityWith(Position{0.0f, 0.0f, 0.0f});
+            frozen = reg.CreateEntityWith(Position{0.0f, 0.0f, 0.0f}, Velocity{2.0f, 0.0f, 0.0f}, Static{});
+        });
+        scheduler.AddSystem([](ChunkView<Position, Not<Static>> chunk)
+        {
+            for (Position& pos : chunk.Get<Position>())
+            {
+                pos.x += 1.0f;
+            }
+        });
+        scheduler.AddSystem<ChunkIntegrate>();
+        
+        EXPECT_EQ(scheduler.GetExecutionPlan(registry).size(), 2u);
+        const auto& units = scheduler.GetExecutionUnits();
+        EXPECT_EQ(units.size(), 2u);
+        EXPECT_EQ(units.back(), (std::vector<size_t>{1, 2}));
+        
+        if (executor)
+            scheduler.Execute(registry, executor);
+        else
+            scheduler.Execute(registry);
+        
+        EXPECT_FLOAT_EQ(registry.GetComponent<Position>(still)->x, 1.0f);
+        EXPECT_FLOAT_EQ(registry.GetComponent<Position>(frozen)->x, 2.0f);
+        for (Entity entity : moving)
+        {
+            EXPECT_FLOAT_EQ(registry.GetComponent<Position>(entity)->x, 3.0f);
+        }
+    };
+    
+    run(nullptr);
+    JobSystem jobs(JobSystem::Config{.workerCount = 2});
+    JobSystemExecutor executor(jobs);
+    run(&executor);
+}